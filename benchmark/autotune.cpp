@@ -0,0 +1,126 @@
+// Sweeps the block and tile sizes of the multiplication on the current machine, and writes the best ones to a
+// tuning profile which can be loaded with gemm::load_tuning_profile or the GEMM_TUNING_PROFILE environment variable.
+//
+// usage: autotune [profile path (gemm_tuning.txt)] [matrix dimension (1024)]
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gemm/gemm.hpp>
+#include <gemm/tuning.hpp>
+
+namespace
+{
+    template<typename T>
+    std::vector<T> random_vector(const int size) {
+        static std::mt19937 gen(42);
+        std::uniform_real_distribution<T> dist(-10, 10);
+        std::vector<T> v(size);
+        for (auto& e : v) {
+            e = dist(gen);
+        }
+        return v;
+    }
+
+    /**
+     * @brief Returns the median time of a `dim x dim` multiplication made with the given sizes.
+     */
+    template<typename T>
+    double measure(const gemm::blocking& sizes, const int dim, const std::vector<T>& A, const std::vector<T>& B, std::vector<T>& C) {
+        using clock = std::chrono::steady_clock;
+        gemm::set_blocking<T>(sizes);
+
+        // the first run is a warmup
+        std::array<double, 6> times;
+        for (auto& time : times) {
+            const auto start = clock::now();
+            gemm::gemm<T>(gemm::transposition::none, gemm::transposition::none, dim, dim, dim, 1, A.data(), dim, B.data(), dim, 0, C.data(), dim, 1);
+            time = std::chrono::duration<double>(clock::now() - start).count();
+        }
+        std::sort(times.begin() + 1, times.end());
+        return times[times.size() / 2];
+    }
+
+    /**
+     * @brief Closest valid sizes to `sizes`, `BM` being rounded to a multiple of the tile height.
+     */
+    gemm::blocking round_sizes(gemm::blocking sizes) {
+        sizes.BM = std::max(sizes.tile_height, sizes.BM - sizes.BM % sizes.tile_height);
+        return sizes;
+    }
+
+    /**
+     * @brief Finds the best sizes for the type `T`, changing one size at a time while keeping the best values
+     * found for the others, starting from the sizes of the process (derived from the caches of the host).
+     */
+    template<typename T>
+    gemm::blocking tune(const int dim) {
+        constexpr int tile_width = gemm::detail::TILE_WIDTH<T>;
+        const std::vector<int> candidates_BM = {60, 120, 180, 240, 360, 480};
+        const std::vector<int> candidates_BN = {tile_width * 2, tile_width * 4, tile_width * 8, tile_width * 16, tile_width * 32};
+        const std::vector<int> candidates_BK = {32, 64, 96, 128, 192, 256, 384};
+
+        const auto A = random_vector<T>(dim * dim);
+        const auto B = random_vector<T>(dim * dim);
+        auto C = random_vector<T>(dim * dim);
+
+        gemm::blocking best = gemm::get_blocking<T>();
+        double best_time = measure<T>(best, dim, A, B, C);
+
+        const auto try_sizes = [&](const gemm::blocking& candidate) {
+            const gemm::blocking sizes = round_sizes(candidate);
+            if (!gemm::detail::is_valid<T>(sizes) || sizes == best) {
+                return;
+            }
+            const double time = measure<T>(sizes, dim, A, B, C);
+            fmt::print("{:>6}: BM={:<4} BN={:<4} BK={:<4} tile_height={:<3} {:.2f} ms\n", gemm::detail::type_name<T>, sizes.BM, sizes.BN, sizes.BK,
+              sizes.tile_height, time * 1e3);
+            if (time < best_time) {
+                best = sizes;
+                best_time = time;
+            }
+        };
+
+        for (int pass = 0; pass < 2; pass++) {
+            for (const int tile_height : gemm::detail::tile_heights) {
+                try_sizes({best.BM, best.BN, best.BK, tile_height});
+            }
+            for (const int BM : candidates_BM) {
+                try_sizes({BM, best.BN, best.BK, best.tile_height});
+            }
+            for (const int BN : candidates_BN) {
+                try_sizes({best.BM, BN, best.BK, best.tile_height});
+            }
+            for (const int BK : candidates_BK) {
+                try_sizes({best.BM, best.BN, BK, best.tile_height});
+            }
+        }
+
+        const double flops = 2.0 * dim * dim * dim / best_time;
+        fmt::print("{:>6}: best BM={} BN={} BK={} tile_height={} ({:.2f} GFLOPS)\n\n", gemm::detail::type_name<T>, best.BM, best.BN, best.BK,
+          best.tile_height, flops / 1e9);
+        return best;
+    }
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::string path = argc > 1 ? argv[1] : "gemm_tuning.txt";
+    const int dim = argc > 2 ? std::atoi(argv[2]) : 1024;
+
+    const gemm::blocking float_sizes = tune<float>(dim);
+    const gemm::blocking double_sizes = tune<double>(dim);
+
+    if (!gemm::save_tuning_profile(path, float_sizes, double_sizes)) {
+        fmt::print(stderr, "could not write the profile to {}\n", path);
+        return EXIT_FAILURE;
+    }
+    fmt::print("profile written to {}\n", path);
+    return EXIT_SUCCESS;
+}
@@ -5,8 +5,16 @@
 #include <fmt/core.h>
 #include <nanobench.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <tuple>
+#include <utility>
+
 #include "util.hpp"
 #include <gemm/gemm.hpp>
+#include <gemm/plan.hpp>
+#include <gemm/strassen.hpp>
 
 using namespace std::chrono_literals;
 
@@ -43,6 +51,10 @@ TEST_CASE("M,N,K <= 8", "[small]") {
         bench.run("gemm", [=] { gemm::sgemm(util::no_trans, util::no_trans, M, N, K, alpha, ptr_A, K, ptr_B, N, beta, ptr_C, N); });
         std::copy(oldC.begin(), oldC.end(), C.begin());
 
+        gemm::gemm_plan<float> plan(util::no_trans, util::no_trans, M, N, K, K, N, N);
+        bench.run("gemm_plan", [=, &plan] { plan.execute(alpha, ptr_A, ptr_B, beta, ptr_C); });
+        std::copy(oldC.begin(), oldC.end(), C.begin());
+
         bench.run("naive", [=] { util::naive_gemm(M, N, K, alpha, ptr_A, K, ptr_B, N, beta, ptr_C, N); });
     }
 }
@@ -129,6 +141,115 @@ TEST_CASE("Non square", "[large]") {
     }
 }
 
+TEST_CASE("Non multiple dimensions", "[large]") {
+    using util::bench;
+
+    bench.warmup(0);
+    bench.minEpochTime(30ms);
+
+    const float alpha = util::random_float<float>();
+    const float beta = util::random_float<float>();
+
+    // dimensions which are not multiples of the tile height, tile width or block sizes
+    const auto M = GENERATE(251, 1001, 4099);
+    const auto K = GENERATE(257, 1001);
+    const auto N = GENERATE(253, 4099);
+
+    CAPTURE(M, N, K);
+    DYNAMIC_SECTION("" << M << "x" << K << " * " << K << "x" << N) {
+        const auto A = util::random_vector<float>(M * K);
+        const auto B = util::random_vector<float>(K * N);
+        auto C = util::random_vector<float>(M * N);
+        auto oldC = C;
+
+        const auto* ptr_A = A.data();
+        const auto* ptr_B = B.data();
+        auto* ptr_C = C.data();
+
+        bench.title(fmt::format("{}x{} * {}x{}", M, K, K, N));
+        bench.batch(M * N);
+
+        bench.run("blas", [=] { cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, alpha, ptr_A, K, ptr_B, N, beta, ptr_C, N); });
+        std::copy(oldC.begin(), oldC.end(), C.begin());
+
+        bench.run("gemm", [=] { gemm::sgemm(util::no_trans, util::no_trans, M, N, K, alpha, ptr_A, K, ptr_B, N, beta, ptr_C, N); });
+    }
+}
+
+TEST_CASE("Transpositions", "[small][large][transposition]") {
+    using util::bench;
+
+    bench.warmup(0);
+    bench.minEpochTime(30ms);
+
+    const float alpha = util::random_float<float>();
+    const float beta = util::random_float<float>();
+
+    // the four combinations of transpositions should run at the same speed, the transpositions being applied while packing
+    const auto dim = GENERATE(48, 512, 2048);
+
+    CAPTURE(dim);
+    DYNAMIC_SECTION("" << dim << "x" << dim << " * " << dim << "x" << dim) {
+        const auto A = util::random_vector<float>(dim * dim);
+        const auto B = util::random_vector<float>(dim * dim);
+        auto C = util::random_vector<float>(dim * dim);
+        auto oldC = C;
+
+        const auto* ptr_A = A.data();
+        const auto* ptr_B = B.data();
+        auto* ptr_C = C.data();
+
+        bench.title(fmt::format("{0}x{0} (transpositions)", dim));
+        bench.batch(dim * dim);
+
+        constexpr auto trans = gemm::transposition::transpose;
+        const std::array<std::tuple<gemm::transposition, gemm::transposition, const char*>, 4> combinations = {
+          {{util::no_trans, util::no_trans, "gemm NN"}, {util::no_trans, trans, "gemm NT"}, {trans, util::no_trans, "gemm TN"}, {trans, trans, "gemm TT"}}};
+        for (const auto& combination : combinations) {
+            const auto transA = std::get<0>(combination);
+            const auto transB = std::get<1>(combination);
+            bench.run(std::get<2>(combination), [=] { gemm::sgemm(transA, transB, dim, dim, dim, alpha, ptr_A, dim, ptr_B, dim, beta, ptr_C, dim); });
+            std::copy(oldC.begin(), oldC.end(), C.begin());
+        }
+    }
+}
+
+TEST_CASE("Matrix-vector", "[large][skinny]") {
+    using util::bench;
+
+    bench.warmup(0);
+    bench.minEpochTime(30ms);
+
+    const float alpha = util::random_float<float>();
+    const float beta = util::random_float<float>();
+
+    // matrix-vector products and skinny matrices, bound by the memory bandwidth
+    const auto dims = GENERATE(std::pair{4096, 1}, std::pair{1, 4096}, std::pair{4096, 4}, std::pair{4, 4096});
+    const auto K = GENERATE(1024, 4096);
+    const int M = dims.first;
+    const int N = dims.second;
+
+    CAPTURE(M, N, K);
+    DYNAMIC_SECTION("" << M << "x" << K << " * " << K << "x" << N) {
+        const auto A = util::random_vector<float>(M * K);
+        const auto B = util::random_vector<float>(K * N);
+        auto C = util::random_vector<float>(M * N);
+        auto oldC = C;
+
+        const auto* ptr_A = A.data();
+        const auto* ptr_B = B.data();
+        auto* ptr_C = C.data();
+
+        bench.title(fmt::format("{}x{} * {}x{}", M, K, K, N));
+        bench.batch(M * N);
+
+        bench.run("blas", [=] { cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, alpha, ptr_A, K, ptr_B, N, beta, ptr_C, N); });
+        std::copy(oldC.begin(), oldC.end(), C.begin());
+
+        bench.run("gemm", [=] { gemm::sgemm(util::no_trans, util::no_trans, M, N, K, alpha, ptr_A, K, ptr_B, N, beta, ptr_C, N); });
+    }
+}
+
 TEST_CASE(">= 1024", "[square][large]") {
     using util::bench;
 
@@ -158,6 +279,10 @@ TEST_CASE(">= 1024", "[square][large]") {
         std::copy(oldC.begin(), oldC.end(), C.begin());
 
         bench.run("gemm", [=] { gemm::sgemm(util::no_trans, util::no_trans, dim, dim, dim, alpha, ptr_A, dim, ptr_B, dim, beta, ptr_C, dim); });
+        std::copy(oldC.begin(), oldC.end(), C.begin());
+
+        bench.run(fmt::format("gemm ({} threads)", util::nb_threads),
+          [=] { gemm::sgemm(util::no_trans, util::no_trans, dim, dim, dim, alpha, ptr_A, dim, ptr_B, dim, beta, ptr_C, dim, util::nb_threads); });
 
         if (util::collect_metrics) {
             const auto& results = bench.results();
@@ -192,15 +317,42 @@ TEST_CASE(">= 4096", "[square][very large]") {
         bench.title(fmt::format("{0}x{0}", dim));
         bench.batch(dim * dim);
 
+        // the bench keeps the results of the previous dimensions
+        const std::size_t first = bench.results().size();
         bench.run("blas", [=] { cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, dim, dim, dim, alpha, ptr_A, dim, ptr_B, dim, beta, ptr_C, dim); });
         std::copy(oldC.begin(), oldC.end(), C.begin());
 
         bench.run("gemm", [=] { gemm::sgemm(util::no_trans, util::no_trans, dim, dim, dim, alpha, ptr_A, dim, ptr_B, dim, beta, ptr_C, dim); });
+        std::copy(oldC.begin(), oldC.end(), C.begin());
+
+        bench.run(fmt::format("gemm ({} threads)", util::nb_threads),
+          [=] { gemm::sgemm(util::no_trans, util::no_trans, dim, dim, dim, alpha, ptr_A, dim, ptr_B, dim, beta, ptr_C, dim, util::nb_threads); });
+        std::copy(oldC.begin(), oldC.end(), C.begin());
+
+        bench.run(fmt::format("strassen ({} threads)", util::nb_threads), [=] {
+            gemm::gemm_strassen<float>(util::no_trans, util::no_trans, dim, dim, dim, alpha, ptr_A, dim, ptr_B, dim, beta, ptr_C, dim, util::nb_threads);
+        });
+
+        // accuracy of a single product, relative to the largest element of the OpenBLAS result
+        auto C_blas = oldC;
+        auto C_strassen = oldC;
+        cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, dim, dim, dim, alpha, ptr_A, dim, ptr_B, dim, beta, C_blas.data(), dim);
+        gemm::gemm_strassen<float>(util::no_trans, util::no_trans, dim, dim, dim, alpha, ptr_A, dim, ptr_B, dim, beta, C_strassen.data(), dim, util::nb_threads);
+        float max_error = 0;
+        float magnitude = 0;
+        for (std::size_t i = 0; i < C_blas.size(); i++) {
+            max_error = std::max(max_error, std::abs(C_strassen[i] - C_blas[i]));
+            magnitude = std::max(magnitude, std::abs(C_blas[i]));
+        }
+
+        using Measure = ankerl::nanobench::Result::Measure;
+        const auto& results = bench.results();
+        const double speedup = results[first].median(Measure::elapsed) / results.back().median(Measure::elapsed);
+        fmt::print("strassen: speedup {:.2f} over blas, max relative error {:.2e}\n", speedup, max_error / magnitude);
 
         if (util::collect_metrics) {
-            const auto& results = bench.results();
-            util::openblas_metrics.push_back(util::average_metrics(results[0]));
-            util::gemm_metrics.push_back(util::average_metrics(results[1]));
+            util::openblas_metrics.push_back(util::average_metrics(results[first]));
+            util::gemm_metrics.push_back(util::average_metrics(results[first + 1]));
             util::dimensions.push_back(dim);
         }
     }
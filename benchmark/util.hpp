@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <random>
 #include <sstream>
+#include <thread>
 #include <vector>
 
 #include <gemm/gemm.hpp>
@@ -18,6 +19,9 @@ namespace util
     // transposition setting
     constexpr auto no_trans = gemm::transposition::none;
 
+    // number of threads used by the multithreaded runs
+    inline const int nb_threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
     // Current Catch2 session config data
     inline Catch::ConfigData config_data;
 
@@ -0,0 +1,100 @@
+#include <gemm/detail/thread_pool.hpp>
+#include <gemm/dispatch.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <string_view>
+
+#include "implementation.hpp"
+
+namespace gemm::dispatch
+{
+    namespace detail
+    {
+        /**
+         * @brief Most capable instruction set supported by the host.
+         */
+        isa host_isa() {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512dq") &&
+                __builtin_cpu_supports("avx512vl")) {
+                return isa::avx512;
+            } else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+                return isa::avx2;
+            } else {
+                return isa::sse4_2;
+            }
+        }
+
+        isa select_isa() {
+            isa selected = host_isa();
+
+            if (const char* value = std::getenv("GEMM_ISA")) {
+                for (const isa requested : {isa::sse4_2, isa::avx2, isa::avx512}) {
+                    if (std::string_view(value) == isa_name(requested) && requested < selected) {
+                        selected = requested;
+                    }
+                }
+            }
+            return selected;
+        }
+
+        implementation get_implementation(const isa instruction_set) {
+            switch (instruction_set) {
+            case isa::avx512:
+                return avx512::get_implementation();
+            case isa::avx2:
+                return avx2::get_implementation();
+            default:
+                return sse4_2::get_implementation();
+            }
+        }
+
+        // Chosen once, when the library is loaded
+        const isa selected = select_isa();
+        const implementation functions = get_implementation(selected);
+    } // namespace detail
+
+    isa selected_isa() {
+        return detail::selected;
+    }
+
+    const char* isa_name(const isa instruction_set) {
+        switch (instruction_set) {
+        case isa::avx512:
+            return "avx512";
+        case isa::avx2:
+            return "avx2";
+        default:
+            return "sse4_2";
+        }
+    }
+
+    void set_num_threads(const int nb_threads) {
+        gemm::detail::num_threads = std::max(nb_threads, 1);
+    }
+
+    int get_num_threads() {
+        return gemm::detail::num_threads;
+    }
+
+    void sgemm(transposition transA, transposition transB, const int M, const int N, const int K, const float alpha, const float* A, const int lda,
+      const float* B, const int ldb, const float beta, float* C, const int ldc, const int nb_threads) {
+        detail::functions.sgemm(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads);
+    }
+
+    void sgemm(transposition transA, transposition transB, const int M, const int N, const int K, const float alpha, const float* A, const int lda,
+      const float* B, const int ldb, const float beta, float* C, const int ldc) {
+        sgemm(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, get_num_threads());
+    }
+
+    void dgemm(transposition transA, transposition transB, const int M, const int N, const int K, const double alpha, const double* A, const int lda,
+      const double* B, const int ldb, const double beta, double* C, const int ldc, const int nb_threads) {
+        detail::functions.dgemm(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads);
+    }
+
+    void dgemm(transposition transA, transposition transB, const int M, const int N, const int K, const double alpha, const double* A, const int lda,
+      const double* B, const int ldb, const double beta, double* C, const int ldc) {
+        dgemm(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, get_num_threads());
+    }
+} // namespace gemm::dispatch
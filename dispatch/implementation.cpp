@@ -0,0 +1,18 @@
+// Built once per instruction set, with GEMM_DISPATCH_ISA set to the name of the instruction set and the matching
+// compiler flags. Each build is a separate shared library whose symbols are hidden except for get_implementation,
+// so that the template instantiations of the different builds are never merged.
+
+#include <gemm/gemm.hpp>
+
+#include "implementation.hpp"
+
+#ifndef GEMM_DISPATCH_ISA
+#error "GEMM_DISPATCH_ISA should be defined"
+#endif
+
+namespace gemm::dispatch::detail::GEMM_DISPATCH_ISA
+{
+    implementation get_implementation() {
+        return {gemm::gemm<float>, gemm::gemm<double>};
+    }
+} // namespace gemm::dispatch::detail::GEMM_DISPATCH_ISA
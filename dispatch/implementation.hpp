@@ -0,0 +1,36 @@
+#ifndef GEMM_DISPATCH_IMPLEMENTATION_HPP
+#define GEMM_DISPATCH_IMPLEMENTATION_HPP
+
+#include <gemm/dispatch.hpp>
+
+namespace gemm::dispatch::detail
+{
+    template<typename T>
+    using gemm_function = void (*)(transposition, transposition, int, int, int, T, const T*, int, const T*, int, T, T*, int, int);
+
+    /**
+     * @brief Entry points of the library built for one instruction set.
+     */
+    struct implementation {
+        gemm_function<float> sgemm;
+        gemm_function<double> dgemm;
+    };
+
+    // One per instruction set, each one being defined in its own shared library (see implementation.cpp)
+    namespace sse4_2
+    {
+        GEMM_DISPATCH_API implementation get_implementation();
+    }
+
+    namespace avx2
+    {
+        GEMM_DISPATCH_API implementation get_implementation();
+    }
+
+    namespace avx512
+    {
+        GEMM_DISPATCH_API implementation get_implementation();
+    }
+} // namespace gemm::dispatch::detail
+
+#endif
@@ -0,0 +1,275 @@
+#ifndef GEMM_BATCH_HPP
+#define GEMM_BATCH_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <vector>
+
+#include "gemm/gemm.hpp"
+
+namespace gemm
+{
+    namespace detail
+    {
+        /**
+         * @brief Parameters shared by the multiplications of a group of a batch.
+         *
+         * The kernels of a group of small multiplications are looked up once for the whole group: the decomposition of
+         * the product in kernels made by `compose_kernel` is stored in `calls` (see `plan_kernels`), and each
+         * multiplication replays it without recursion, after copying its transposed operands to the workspace.
+         */
+        template<typename T>
+        struct batch_group {
+            bool transA;
+            bool transB;
+            int M;
+            int N;
+            int K;
+            T alpha;
+            int lda;
+            int ldb;
+            T beta;
+            int ldc;
+            blocking sizes;
+            int kernel_lda = 0;
+            int kernel_ldb = 0;
+            std::vector<kernel_call<T>> calls;
+
+            batch_group(transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const int lda, const int ldb,
+              const T beta, const int ldc)
+              : transA(transA != transposition::none), transB(transB != transposition::none), M(M), N(N), K(K), alpha(alpha), lda(lda), ldb(ldb),
+                beta(beta), ldc(ldc), sizes(get_blocking<T>()) {
+                // the kernels need non empty matrices, gemm_small only scales C for an empty product
+                if (is_small(M, N, K) && M > 0 && N > 0 && K > 0) {
+                    // the transposed operands are copied to the workspace as row major matrices
+                    kernel_lda = this->transA ? K : lda;
+                    kernel_ldb = this->transB ? N : ldb;
+                    plan_kernels(M, N, K, kernel_lda, kernel_ldb, ldc, 0, 0, 0, false, calls);
+                }
+            }
+
+            /**
+             * @brief Number of elements of the workspace needed by one multiplication of the group using at most
+             * `nb_threads` threads.
+             */
+            std::size_t workspace_size(const int nb_threads) const {
+                if (is_small(M, N, K)) {
+                    return small_workspace_size(M, N, K);
+                } else if (is_skinny(M, N)) {
+                    return skinny_workspace_size(M, N, K, nb_threads);
+                } else {
+                    return blocked_workspace_size<T>(sizes, N, nb_threads);
+                }
+            }
+
+            /**
+             * @brief Computes `C = alpha * op(A)op(B) + beta * C`, using `work` for the intermediate buffers. Only the
+             * skinny and blocked paths use more than the calling thread, `work` then holds `nb_threads` panel workspaces.
+             */
+            void multiply(const T* A, const T* B, T* C, const int nb_threads, T* work) const {
+                if (!calls.empty()) {
+                    T* work_A = work;
+                    T* work_B = work_A + M * K;
+                    if (transA) {
+                        pack_block(true, M, K, A, lda, work_A, K);
+                    }
+                    if (transB) {
+                        pack_block(true, K, N, B, ldb, work_B, N);
+                    }
+                    run_kernels<T>(calls, alpha, transA ? work_A : A, kernel_lda, transB ? work_B : B, kernel_ldb, beta, C, ldc);
+                } else if (is_small(M, N, K)) {
+                    gemm_small(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, work);
+                } else if (is_skinny(M, N)) {
+                    gemm_skinny(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads, work);
+                } else {
+                    gemm(M, N, K, alpha, operand<T>{A, lda, transA}, operand<T>{B, ldb, transB}, beta, C, ldc, sizes, nb_threads, work);
+                }
+            }
+        };
+
+        /**
+         * @brief Number of consecutive multiplications of a batch making a task, so that each of the `nb_threads`
+         * threads gets a few tasks.
+         */
+        constexpr int batch_grain(const int batch_size, const int nb_threads) {
+            return std::max(1, batch_size / (4 * nb_threads));
+        }
+
+        /**
+         * @brief Runs the multiplications of a batch, `operands(i)` returning the pointers `{A, B, C}` of the
+         * multiplication `i`. The multiplications [group_end[g - 1], group_end[g]) belong to `groups[g]`.
+         *
+         * The threads share the multiplications, each one running on a single thread. When there are fewer
+         * multiplications than threads, they are run one after the other, each one using all the threads.
+         */
+        template<typename T, typename Operands>
+        void gemm_batch(std::span<const batch_group<T>> groups, std::span<const int> group_end, Operands operands, const int nb_threads, workspace<T>& ws) {
+            const int batch_size = group_end.empty() ? 0 : group_end.back();
+
+            // a multiplication runs on a single thread, or on all of them if there are fewer multiplications than threads
+            std::size_t item_workspace_size = 0;
+            std::size_t shared_workspace_size = 0;
+            for (const auto& group : groups) {
+                item_workspace_size = std::max(item_workspace_size, group.workspace_size(1));
+                shared_workspace_size = std::max(shared_workspace_size, group.workspace_size(nb_threads));
+            }
+            ws.reserve(std::max(nb_threads * item_workspace_size, shared_workspace_size));
+            T* work = ws.data();
+
+            if (batch_size < nb_threads) {
+                for (int i = 0, g = 0; i < batch_size; i++) {
+                    while (i >= group_end[g]) {
+                        g++;
+                    }
+                    const auto [A, B, C] = operands(i);
+                    groups[g].multiply(A, B, C, nb_threads, work);
+                }
+                return;
+            }
+
+            const int grain = batch_grain(batch_size, nb_threads);
+            const int nb_tasks = (batch_size + grain - 1) / grain;
+
+            parallel_for(nb_tasks, nb_threads, [&](const int task, const int thread_id) {
+                T* thread_work = work + thread_id * item_workspace_size;
+                const int first = task * grain;
+                const int last = std::min(first + grain, batch_size);
+
+                int g = static_cast<int>(std::upper_bound(group_end.begin(), group_end.end(), first) - group_end.begin());
+                for (int i = first; i < last; i++) {
+                    while (i >= group_end[g]) {
+                        g++;
+                    }
+                    const auto [A, B, C] = operands(i);
+                    groups[g].multiply(A, B, C, 1, thread_work);
+                }
+            });
+        }
+    } // namespace detail
+
+    /**
+     * @brief Performs `group_count` groups of independent multiplications `C[i] = alpha * op(A[i])op(B[i]) + beta * C[i]`,
+     * using at most `nb_threads` threads and the buffers of `ws`.
+     *
+     * The multiplications of group `g` share the parameters `transA[g]`, ..., `ldc[g]`, and there are `group_size[g]`
+     * of them. The operands of the multiplications are stored one group after the other in `A`, `B` and `C`.
+     *
+     * The kernels used by a group of small multiplications are looked up once for the group, and each multiplication
+     * runs on a single thread, the threads sharing the multiplications of the batch. `ws` holds `nb_threads` times
+     * the workspace needed by the largest multiplication.
+     */
+    template<typename T>
+    void gemm_batch(const transposition* transA, const transposition* transB, const int* M, const int* N, const int* K, const T* alpha, const T* const* A,
+      const int* lda, const T* const* B, const int* ldb, const T* beta, T* const* C, const int* ldc, const int group_count, const int* group_size,
+      const int nb_threads, workspace<T>& ws) {
+        std::vector<detail::batch_group<T>> groups;
+        std::vector<int> group_end;
+        groups.reserve(group_count);
+        group_end.reserve(group_count);
+
+        int batch_size = 0;
+        for (int g = 0; g < group_count; g++) {
+            groups.emplace_back(transA[g], transB[g], M[g], N[g], K[g], alpha[g], lda[g], ldb[g], beta[g], ldc[g]);
+            batch_size += group_size[g];
+            group_end.push_back(batch_size);
+        }
+
+        const int threads = std::clamp(nb_threads, 1, detail::max_threads());
+        detail::gemm_batch<T>(groups, group_end, [=](const int i) { return std::tuple{A[i], B[i], C[i]}; }, threads, ws);
+    }
+
+    /**
+     * @brief Performs groups of independent multiplications using at most `nb_threads` threads and the workspace of
+     * the calling thread.
+     */
+    template<typename T>
+    void gemm_batch(const transposition* transA, const transposition* transB, const int* M, const int* N, const int* K, const T* alpha, const T* const* A,
+      const int* lda, const T* const* B, const int* ldb, const T* beta, T* const* C, const int* ldc, const int group_count, const int* group_size,
+      const int nb_threads) {
+        gemm_batch<T>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, group_count, group_size, nb_threads, detail::default_workspace<T>());
+    }
+
+    /**
+     * @brief Performs groups of independent multiplications using the process wide number of threads.
+     */
+    template<typename T>
+    void gemm_batch(const transposition* transA, const transposition* transB, const int* M, const int* N, const int* K, const T* alpha, const T* const* A,
+      const int* lda, const T* const* B, const int* ldb, const T* beta, T* const* C, const int* ldc, const int group_count, const int* group_size) {
+        gemm_batch<T>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, group_count, group_size, get_num_threads());
+    }
+
+    /**
+     * @brief Performs `batch_size` independent multiplications `C[i] = alpha * op(A[i])op(B[i]) + beta * C[i]` of
+     * the same dimensions, using at most `nb_threads` threads and the buffers of `ws`.
+     */
+    template<typename T>
+    void gemm_batch(transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const T* const* A, const int lda,
+      const T* const* B, const int ldb, const T beta, T* const* C, const int ldc, const int batch_size, const int nb_threads, workspace<T>& ws) {
+        gemm_batch<T>(&transA, &transB, &M, &N, &K, &alpha, A, &lda, B, &ldb, &beta, C, &ldc, 1, &batch_size, nb_threads, ws);
+    }
+
+    /**
+     * @brief Performs independent multiplications of the same dimensions using at most `nb_threads` threads and the
+     * workspace of the calling thread.
+     */
+    template<typename T>
+    void gemm_batch(transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const T* const* A, const int lda,
+      const T* const* B, const int ldb, const T beta, T* const* C, const int ldc, const int batch_size, const int nb_threads) {
+        gemm_batch<T>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, batch_size, nb_threads, detail::default_workspace<T>());
+    }
+
+    /**
+     * @brief Performs independent multiplications of the same dimensions using the process wide number of threads.
+     */
+    template<typename T>
+    void gemm_batch(transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const T* const* A, const int lda,
+      const T* const* B, const int ldb, const T beta, T* const* C, const int ldc, const int batch_size) {
+        gemm_batch<T>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, batch_size, get_num_threads());
+    }
+
+    /**
+     * @brief Performs `batch_size` independent multiplications `C_i = alpha * op(A_i)op(B_i) + beta * C_i` of the
+     * same dimensions, the operands being stored at regular intervals: `A_i = A + i * stride_A`, and likewise for
+     * `B_i` and `C_i`. A stride of 0 for `A` or `B` uses the same operand for all the multiplications.
+     *
+     * Small multiplications call the kernels generated for their dimensions, looked up once for the batch, the others
+     * use the blocked path. The multiplications are shared between at most `nb_threads` threads, as in `gemm_batch`.
+     */
+    template<typename T>
+    void gemm_batch_strided(transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const T* A, const int lda,
+      const std::ptrdiff_t stride_A, const T* B, const int ldb, const std::ptrdiff_t stride_B, const T beta, T* C, const int ldc,
+      const std::ptrdiff_t stride_C, const int batch_size, const int nb_threads, workspace<T>& ws) {
+        const detail::batch_group<T> group(transA, transB, M, N, K, alpha, lda, ldb, beta, ldc);
+        const int threads = std::clamp(nb_threads, 1, detail::max_threads());
+        detail::gemm_batch<T>(
+          std::span(&group, 1), std::span(&batch_size, 1),
+          [=](const int i) { return std::tuple{A + i * stride_A, B + i * stride_B, C + i * stride_C}; }, threads, ws);
+    }
+
+    /**
+     * @brief Performs strided independent multiplications using at most `nb_threads` threads and the workspace of
+     * the calling thread.
+     */
+    template<typename T>
+    void gemm_batch_strided(transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const T* A, const int lda,
+      const std::ptrdiff_t stride_A, const T* B, const int ldb, const std::ptrdiff_t stride_B, const T beta, T* C, const int ldc,
+      const std::ptrdiff_t stride_C, const int batch_size, const int nb_threads) {
+        gemm_batch_strided<T>(transA, transB, M, N, K, alpha, A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_size, nb_threads,
+          detail::default_workspace<T>());
+    }
+
+    /**
+     * @brief Performs strided independent multiplications using the process wide number of threads.
+     */
+    template<typename T>
+    void gemm_batch_strided(transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const T* A, const int lda,
+      const std::ptrdiff_t stride_A, const T* B, const int ldb, const std::ptrdiff_t stride_B, const T beta, T* C, const int ldc,
+      const std::ptrdiff_t stride_C, const int batch_size) {
+        gemm_batch_strided<T>(
+          transA, transB, M, N, K, alpha, A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_size, get_num_threads());
+    }
+} // namespace gemm
+
+#endif
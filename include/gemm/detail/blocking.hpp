@@ -0,0 +1,99 @@
+#ifndef GEMM_BLOCKING_HPP
+#define GEMM_BLOCKING_HPP
+
+#include <eve/eve.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "gemm/types.hpp"
+
+namespace gemm::detail
+{
+    // number of SIMD registers of the target
+#if defined(__AVX512F__) || defined(__aarch64__)
+    constexpr int simd_registers = 32;
+#else
+    constexpr int simd_registers = 16;
+#endif
+
+    // microkernel shape: a tile of C is TILE_HEIGHT (MR) rows of TILE_WIDES registers (NR = TILE_WIDTH columns)
+    template<typename T>
+    constexpr int TILE_WIDES = 2;
+
+    template<typename T>
+    constexpr int TILE_WIDTH = TILE_WIDES<T> * eve::wide<T>::size();
+
+    /**
+     * @brief Tells if a tile of `tile_height` rows is held in registers by the microkernel, along with a row of B and a
+     * broadcast element of A, so that it does not spill.
+     */
+    constexpr bool fits_registers(const int tile_height) {
+        return tile_height * TILE_WIDES<float> + TILE_WIDES<float> + 1 <= simd_registers;
+    }
+
+    template<typename T>
+    constexpr int TILE_HEIGHT = simd_registers >= 32 ? 12 : 6;
+
+    static_assert(fits_registers(TILE_HEIGHT<float>));
+
+    // default size constants
+    template<typename T>
+    constexpr int BM = 240; // rows of A
+
+    template<typename T>
+    constexpr int BN = 64; // columns of B
+
+    template<typename T>
+    constexpr int BK = 70; // columns of A/rows of B
+
+    template<typename T>
+    constexpr blocking default_blocking = {BM<T>, BN<T>, BK<T>, TILE_HEIGHT<T>};
+
+    /**
+     * @brief Tile heights for which the blocked multiplication is compiled: the ones of {4, 6, 8, 10, 12} whose tiles
+     * fit in the registers of the target (up to 6 rows with 16 registers), so that neither `set_blocking` nor the
+     * autotuner can choose a microkernel which spills.
+     */
+    constexpr auto tile_heights = [] {
+        constexpr std::array candidates = {4, 6, 8, 10, 12};
+        std::array<int, std::ranges::count_if(candidates, fits_registers)> heights{};
+        std::ranges::copy_if(candidates, heights.begin(), fits_registers);
+        return heights;
+    }();
+
+    /**
+     * @brief Tells if the blocked multiplication can use the given sizes: the tile height must be one of
+     * `tile_heights`, and the blocks must be made of whole tiles.
+     */
+    template<typename T>
+    constexpr bool is_valid(const blocking& sizes) {
+        return sizes.BM > 0 && sizes.BN > 0 && sizes.BK > 0 && std::ranges::find(tile_heights, sizes.tile_height) != tile_heights.end() &&
+               sizes.BM % sizes.tile_height == 0 && sizes.BN % TILE_WIDTH<T> == 0;
+    }
+
+    static_assert(is_valid<float>(default_blocking<float>) && is_valid<double>(default_blocking<double>));
+
+    /**
+     * @brief Number of elements of the workspace used by each thread of the blocked multiplication: the `BM x BK`
+     * block of `A`.
+     */
+    constexpr std::size_t block_workspace_size(const blocking& sizes) {
+        return static_cast<std::size_t>(sizes.BM) * sizes.BK;
+    }
+
+    /**
+     * @brief Calls `f` with the tile height as a `std::integral_constant`, `tile_height` being one of `tile_heights`.
+     */
+    template<typename F>
+    void with_tile_height(const int tile_height, F&& f) {
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            ((tile_height == tile_heights[I] && (f(std::integral_constant<int, tile_heights[I]>{}), true)) || ...);
+        }(std::make_index_sequence<tile_heights.size()>{});
+    }
+} // namespace gemm::detail
+
+#endif
@@ -0,0 +1,198 @@
+#ifndef GEMM_CACHE_HPP
+#define GEMM_CACHE_HPP
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <fstream>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace gemm::detail
+{
+    /**
+     * @brief Data cache sizes, in bytes, available to a core. A size of 0 means that the cache was not detected.
+     *
+     * The shared levels are divided between the cores sharing them, `shared_L3` being the whole size of the L3 the
+     * core belongs to.
+     */
+    struct cache_sizes {
+        std::size_t L1 = 0;
+        std::size_t L2 = 0;
+        std::size_t L3 = 0;
+        std::size_t shared_L3 = 0;
+
+        constexpr bool detected() const {
+            return L1 != 0 && L2 != 0;
+        }
+    };
+
+    /**
+     * @brief Stores the size of a data or unified cache of the given level, `size` being the size of the whole cache
+     * and `sharing` the number of cores sharing it.
+     */
+    inline void set_cache_size(cache_sizes& sizes, const int level, const std::size_t size, const std::size_t sharing) {
+        switch (level) {
+        case 1:
+            sizes.L1 = size / sharing;
+            break;
+        case 2:
+            sizes.L2 = size / sharing;
+            break;
+        case 3:
+            sizes.L3 = size / sharing;
+            sizes.shared_L3 = size;
+            break;
+        default:
+            break;
+        }
+    }
+
+    /**
+     * @brief Parses a size as written in sysfs ("48K", "2048K", "32M").
+     */
+    inline std::size_t parse_cache_size(const std::string& text) {
+        std::size_t size = 0;
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), size);
+        if (error != std::errc{}) {
+            return 0;
+        }
+        if (end != text.data() + text.size()) {
+            switch (*end) {
+            case 'K':
+                return size << 10;
+            case 'M':
+                return size << 20;
+            case 'G':
+                return size << 30;
+            default:
+                break;
+            }
+        }
+        return size;
+    }
+
+    /**
+     * @brief Number of cpus in a sysfs cpu list ("0", "0,64", "0-7,16-23").
+     */
+    inline int count_cpus(const std::string& list) {
+        int count = 0;
+        const char* current = list.data();
+        const char* end = list.data() + list.size();
+        while (current < end) {
+            int first = 0;
+            int last = 0;
+            auto result = std::from_chars(current, end, first);
+            last = first;
+            if (result.ec == std::errc{} && result.ptr < end && *result.ptr == '-') {
+                result = std::from_chars(result.ptr + 1, end, last);
+            }
+            if (result.ec != std::errc{} || last < first) {
+                return 1;
+            }
+            count += last - first + 1;
+            current = result.ptr + 1; // skips the ','
+        }
+        return count > 0 ? count : 1;
+    }
+
+    /**
+     * @brief Reads the cache sizes of the first cpu from `/sys/devices/system/cpu/cpu0/cache` (Linux).
+     */
+    inline cache_sizes read_sysfs_cache_sizes() {
+        cache_sizes sizes;
+        for (int index = 0;; index++) {
+            const std::string path = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(index) + "/";
+            std::ifstream level_file(path + "level");
+            if (!level_file) {
+                break;
+            }
+
+            int level = 0;
+            std::string type;
+            std::string size;
+            std::string shared_cpus;
+            level_file >> level;
+            std::ifstream(path + "type") >> type;
+            std::ifstream(path + "size") >> size;
+            std::ifstream(path + "shared_cpu_list") >> shared_cpus;
+
+            if (type == "Data" || type == "Unified") {
+                // the first levels are private to a core (even if shared by its hardware threads)
+                const int sharing = level >= 3 ? count_cpus(shared_cpus) : 1;
+                set_cache_size(sizes, level, parse_cache_size(size), sharing);
+            }
+        }
+        return sizes;
+    }
+
+    /**
+     * @brief Reads the cache sizes from the cpuid instruction, using the deterministic cache parameters leaf
+     * (4 on Intel, 0x8000001D on AMD).
+     */
+    inline cache_sizes read_cpuid_cache_sizes() {
+        cache_sizes sizes;
+#if defined(__x86_64__) || defined(__i386__)
+        unsigned int eax = 0;
+        unsigned int ebx = 0;
+        unsigned int ecx = 0;
+        unsigned int edx = 0;
+
+        // the vendor string starts with "Auth" (AuthenticAMD) on AMD processors
+        unsigned int leaf = 4;
+        if (__get_cpuid(0, &eax, &ebx, &ecx, &edx) && ebx == 0x68747541) {
+            leaf = 0x8000001D;
+        }
+
+        for (unsigned int index = 0; __get_cpuid_count(leaf, index, &eax, &ebx, &ecx, &edx); index++) {
+            const unsigned int type = eax & 0x1F; // 0: no more caches, 1: data, 2: instructions, 3: unified
+            if (type == 0) {
+                break;
+            }
+            if (type == 2) {
+                continue;
+            }
+
+            const int level = (eax >> 5) & 0x7;
+            const std::size_t ways = ((ebx >> 22) & 0x3FF) + 1;
+            const std::size_t partitions = ((ebx >> 12) & 0x3FF) + 1;
+            const std::size_t line_size = (ebx & 0xFFF) + 1;
+            const std::size_t sets = static_cast<std::size_t>(ecx) + 1;
+            // number of logical cpus sharing the cache, an upper bound on the number of cores
+            const std::size_t sharing = level >= 3 ? ((eax >> 14) & 0xFFF) + 1 : 1;
+            set_cache_size(sizes, level, ways * partitions * line_size * sets, sharing);
+        }
+#endif
+        return sizes;
+    }
+
+    /**
+     * @brief Cache sizes of the host, from sysfs or, if they are not available there, from cpuid. They are detected
+     * once per process.
+     */
+    inline const cache_sizes& host_cache_sizes() {
+        static const cache_sizes sizes = [] {
+            const cache_sizes from_sysfs = read_sysfs_cache_sizes();
+            return from_sysfs.detected() ? from_sysfs : read_cpuid_cache_sizes();
+        }();
+        return sizes;
+    }
+
+    /**
+     * @brief Size in bytes of the last level cache shared by the cores sharing the one of the calling core: a single
+     * L3 (not the sum of the L3 of every socket or core complex), or the L2 of a core if there is no L3, or 8 MiB if
+     * the caches cannot be detected.
+     */
+    inline std::size_t shared_cache_size() {
+        const cache_sizes& caches = host_cache_sizes();
+        if (!caches.detected()) {
+            return std::size_t{8} << 20;
+        }
+        return caches.shared_L3 != 0 ? caches.shared_L3 : caches.L2;
+    }
+} // namespace gemm::detail
+
+#endif
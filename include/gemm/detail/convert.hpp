@@ -0,0 +1,20 @@
+#ifndef GEMM_CONVERT_HPP
+#define GEMM_CONVERT_HPP
+
+namespace gemm::detail
+{
+    /**
+     * @brief Converts `size` contiguous elements of type `S` to `T`, one at a time.
+     *
+     * The 16-bit storage types provide overloads (found by argument dependent lookup) converting whole registers, so
+     * the packing functions call `convert_elements` unqualified.
+     */
+    template<typename T, typename S>
+    void convert_elements(const S* src, const int size, T* dst) {
+        for (int i = 0; i < size; i++) {
+            dst[i] = static_cast<T>(src[i]);
+        }
+    }
+} // namespace gemm::detail
+
+#endif
@@ -0,0 +1,376 @@
+#ifndef GEMM_GEMV_HPP
+#define GEMM_GEMV_HPP
+
+#include <eve/eve.hpp>
+#include <eve/module/core.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "gemm/epilogue.hpp"
+#include "pack.hpp"
+#include "thread_pool.hpp"
+#include "update.hpp"
+
+namespace gemm::detail
+{
+    /**
+     * @brief Maximum number of rows of `op(A)` or columns of `op(B)` of the multiplications handled by `gemm_skinny`.
+     */
+    constexpr int skinny_max_dim = 4;
+
+    /**
+     * @brief Number of elements of the long dimension computed by `gemm_skinny` before the epilogue is applied to them,
+     * so that they are still in cache.
+     */
+    constexpr int skinny_epilogue_chunk = 1024;
+
+    /**
+     * @brief Tells if a multiplication which is not small is handled by `gemm_skinny`: `C` has at most
+     * `skinny_max_dim` rows or columns, matrix-vector products included.
+     */
+    constexpr bool is_skinny(const int M, const int N) {
+        return std::min(M, N) <= skinny_max_dim;
+    }
+
+    /**
+     * @brief Minimum number of elements of the long dimension computed by a thread of `gemm_skinny`, so that it streams
+     * its part at full speed.
+     */
+    constexpr int skinny_min_chunk = 256;
+
+    /**
+     * @brief Minimum number of elements of the long operand read by a task of `gemm_skinny` when K is split.
+     */
+    constexpr std::size_t skinny_min_task = 256 * 256;
+
+    /**
+     * @brief Split of a skinny multiplication between the threads: the long dimension in `chunks` of at least
+     * `skinny_min_chunk` elements, and K in `parts` when there are fewer chunks than threads (e.g. a few short rows
+     * with a very long K), each task reading at least `skinny_min_task` elements of the long operand.
+     */
+    struct skinny_split {
+        int chunks;
+        int parts;
+    };
+
+    constexpr skinny_split split_skinny(const int length, const int K, const int nb_threads) {
+        const int chunks = std::clamp(length / skinny_min_chunk, 1, nb_threads);
+        const std::size_t task_size = static_cast<std::size_t>(length / chunks) * K;
+        const int parts = static_cast<int>(std::clamp<std::size_t>(task_size / skinny_min_task, 1, nb_threads / chunks));
+        return {chunks, parts};
+    }
+
+    /**
+     * @brief Number of elements of the workspace used by `gemm_skinny` with `nb_threads` threads: the copies of the
+     * short vectors, followed by the partial output vectors of each part of K if K is split (see `split_skinny`).
+     */
+    constexpr std::size_t skinny_workspace_size(const int M, const int N, const int K, const int nb_threads) {
+        const int NV = std::min(M, N);
+        const int length = std::max(M, N);
+        const int parts = split_skinny(length, K, nb_threads).parts;
+        const std::size_t partials = parts > 1 ? static_cast<std::size_t>(parts) * NV * length : 0;
+        return static_cast<std::size_t>(NV) * K + partials;
+    }
+
+    /**
+     * @brief Loads a register of consecutive elements, converting them to `T` by whole registers (see
+     * `convert_elements`) if they are stored with another type.
+     */
+    template<typename T, typename S>
+    eve::wide<T> load_wide(const S* src) {
+        if constexpr (std::is_same_v<S, T>) {
+            return eve::wide<T>{src};
+        } else {
+            std::array<T, eve::wide<T>::size()> converted;
+            convert_elements(src, eve::wide<T>::size(), converted.data());
+            return eve::wide<T>{converted.data()};
+        }
+    }
+
+    /**
+     * @brief Dot products of `R` rows of `X` (with `ld` elements between two rows) and `NV` vectors `x` (stored one
+     * after the other, `K` elements each): `dots[r][v] = sum_k X[r][k] * x[v][k]`.
+     *
+     * Each register of a vector is used for the `R` rows, so `X` is read once, in unit stride.
+     */
+    template<typename T, int R, int NV, typename S>
+    void dot_rows(const int K, const S* X, const int ld, const T* x, std::array<std::array<T, NV>, R>& dots) {
+        using wide_t = eve::wide<T>;
+        constexpr int size = wide_t::size();
+
+        std::array<std::array<wide_t, NV>, R> acc;
+        for (auto& row : acc) {
+            row.fill(wide_t{T{0}});
+        }
+
+        const int full_K = K - K % size;
+        for (int k = 0; k < full_K; k += size) {
+            std::array<wide_t, NV> wx;
+            for (int v = 0; v < NV; v++) {
+                wx[v] = wide_t{x + v * K + k};
+            }
+            for (int r = 0; r < R; r++) {
+                const wide_t wa = load_wide<T>(X + r * ld + k);
+                for (int v = 0; v < NV; v++) {
+                    acc[r][v] = eve::fma(wa, wx[v], acc[r][v]);
+                }
+            }
+        }
+
+        for (int r = 0; r < R; r++) {
+            for (int v = 0; v < NV; v++) {
+                T dot = eve::reduce(acc[r][v]);
+                for (int k = full_K; k < K; k++) {
+                    dot += static_cast<T>(X[r * ld + k]) * x[v * K + k];
+                }
+                dots[r][v] = dot;
+            }
+        }
+    }
+
+    /**
+     * @brief Linear combinations of the rows of `X` over `CW` registers of columns: `sums[v][j] = sum_k X[k][j] * x[v][k]`.
+     *
+     * The sums stay in registers for the whole K dimension, so `X` is read once, a few registers per row.
+     */
+    template<typename T, int CW, int NV, typename S>
+    void axpy_columns(const int K, const S* X, const int ld, const T* x, std::array<std::array<eve::wide<T>, CW>, NV>& sums) {
+        using wide_t = eve::wide<T>;
+        constexpr int size = wide_t::size();
+
+        for (auto& row : sums) {
+            row.fill(wide_t{T{0}});
+        }
+
+        for (int k = 0; k < K; k++) {
+            std::array<wide_t, CW> wa;
+            for (int c = 0; c < CW; c++) {
+                wa[c] = load_wide<T>(X + k * ld + c * size);
+            }
+            for (int v = 0; v < NV; v++) {
+                const wide_t wx{x[v * K + k]};
+                for (int c = 0; c < CW; c++) {
+                    sums[v][c] = eve::fma(wx, wa[c], sums[v][c]);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Output of a skinny multiplication: the element `j` of the output vector `v` is the element
+     * `C[j * inc_j + v * inc_v]`.
+     */
+    template<typename T>
+    struct skinny_output {
+        T alpha;
+        T beta;
+        T* C;
+        int inc_j;
+        int inc_v;
+
+        void store(const int j, const int v, const T ab) const {
+            update(alpha, ab, beta, C + j * inc_j + v * inc_v);
+        }
+    };
+
+    /**
+     * @brief Computes the elements [first, last) of the `NV` output vectors as dot products with the rows of `X`.
+     */
+    template<typename T, int NV, typename S>
+    void skinny_dot(const int first, const int last, const int K, const S* X, const int ld, const T* x, const skinny_output<T>& out) {
+        // the rows processed together share the registers of the vectors
+        constexpr int R = NV <= 2 ? 4 : 2;
+
+        const auto store = [&](const int j, const auto& dots) {
+            for (int r = 0; r < static_cast<int>(dots.size()); r++) {
+                for (int v = 0; v < NV; v++) {
+                    out.store(j + r, v, dots[r][v]);
+                }
+            }
+        };
+
+        int j = first;
+        for (; j + R <= last; j += R) {
+            std::array<std::array<T, NV>, R> dots;
+            dot_rows<T, R, NV>(K, X + static_cast<std::size_t>(j) * ld, ld, x, dots);
+            store(j, dots);
+        }
+        for (; j < last; j++) {
+            std::array<std::array<T, NV>, 1> dots;
+            dot_rows<T, 1, NV>(K, X + static_cast<std::size_t>(j) * ld, ld, x, dots);
+            store(j, dots);
+        }
+    }
+
+    /**
+     * @brief Computes the elements [first, last) of the `NV` output vectors as linear combinations of the rows of `X`,
+     * by strips of registers of columns.
+     */
+    template<typename T, int NV, typename S>
+    void skinny_axpy(const int first, const int last, const int K, const S* X, const int ld, const T* x, const skinny_output<T>& out) {
+        using wide_t = eve::wide<T>;
+        constexpr int size = wide_t::size();
+        // the strips are as wide as the registers allow, the sums of the NV vectors being kept in registers
+        constexpr int CW = std::max(1, 8 / NV);
+
+        const auto strip = [&]<int W>(const int j) {
+            std::array<std::array<wide_t, W>, NV> sums;
+            axpy_columns<T, W, NV>(K, X + j, ld, x, sums);
+            for (int v = 0; v < NV; v++) {
+                for (int c = 0; c < W; c++) {
+                    for (int l = 0; l < size; l++) {
+                        out.store(j + c * size + l, v, sums[v][c].get(l));
+                    }
+                }
+            }
+        };
+
+        int j = first;
+        for (; j + CW * size <= last; j += CW * size) {
+            strip.template operator()<CW>(j);
+        }
+        for (; j + size <= last; j += size) {
+            strip.template operator()<1>(j);
+        }
+        for (; j < last; j++) {
+            for (int v = 0; v < NV; v++) {
+                T sum = 0;
+                for (int k = 0; k < K; k++) {
+                    sum += static_cast<T>(X[static_cast<std::size_t>(k) * ld + j]) * x[v * K + k];
+                }
+                out.store(j, v, sum);
+            }
+        }
+    }
+
+    template<typename T, typename S>
+    using skinny_function = void (*)(int, int, int, const S*, int, const T*, const skinny_output<T>&);
+
+    /**
+     * @brief Kernels of the skinny multiplications: `skinny_kernels<T, S>[axpy][NV - 1]` computes `NV` output vectors
+     * with dot products of the rows of the long operand (`axpy` false) or linear combinations of them (`axpy` true).
+     */
+    template<typename T, typename S>
+    constexpr auto skinny_kernels = []<int... V>(std::integer_sequence<int, V...>) {
+        return std::array{
+          std::array<skinny_function<T, S>, sizeof...(V)>{&skinny_dot<T, V + 1, S>...},
+          std::array<skinny_function<T, S>, sizeof...(V)>{&skinny_axpy<T, V + 1, S>...},
+        };
+    }(std::make_integer_sequence<int, skinny_max_dim>{});
+
+    /**
+     * @brief Matrix multiplication where `C` has at most `skinny_max_dim` rows or columns, matrix-vector products
+     * included.
+     *
+     * The product is made of `NV = min(M, N)` products of the long operand (`op(A)` if `N` is the short dimension,
+     * `op(B)` otherwise) by vectors of `K` elements, which are copied to `work` (`skinny_workspace_size(M, N, K,
+     * nb_threads)` elements). The long operand is streamed once without being packed: its rows are either multiplied
+     * by the vectors (dot products) or combined by them (linear combinations), depending on whether they run along `K`
+     * or along the long dimension. The long dimension is split between at most `nb_threads` threads, and so is K if
+     * the long dimension is too short for all of them: each part of K then computes partial output vectors in `work`,
+     * which are summed to `C` at the end. The epilogue `post` is applied by pieces of `skinny_epilogue_chunk` elements
+     * of the long dimension as they are stored.
+     */
+    template<typename T, typename S>
+    void gemm_skinny(const bool transA, const bool transB, const int M, const int N, const int K, const T alpha, const S* A, const int lda, const S* B,
+      const int ldb, const T beta, T* C, const int ldc, const int nb_threads, T* work, const epilogue<T>& post = {}) {
+        const operand<S> op_A{A, lda, transA};
+        const operand<S> op_B{B, ldb, transB};
+
+        // the output vectors are the columns of C if N is short, its rows otherwise
+        const bool short_N = N <= M;
+        const int NV = short_N ? N : M;
+        const int length = short_N ? M : N;
+        if (NV == 0) {
+            return;
+        }
+        const operand<S>& vectors = short_N ? op_B : op_A;
+        const operand<S>& matrix = short_N ? op_A : op_B;
+
+        // chunks of whole registers of the long dimension, and parts of K of whole registers
+        constexpr int size = eve::wide<T>::size();
+        const auto [nb_chunks, nb_parts] = split_skinny(length, K, nb_threads);
+        const int chunk = ((length + nb_chunks - 1) / nb_chunks + size - 1) / size * size;
+        const int part_K = nb_parts == 1 ? K : ((K + nb_parts - 1) / nb_parts + size - 1) / size * size;
+        const int parts = nb_parts == 1 ? 1 : (K + part_K - 1) / part_K;
+
+        // the vectors of each part of K are stored one after the other
+        for (int k0 = 0; k0 < K; k0 += part_K) {
+            const int real_K = std::min(K - k0, part_K);
+            T* x = work + static_cast<std::size_t>(NV) * k0;
+            for (int v = 0; v < NV; v++) {
+                for (int k = 0; k < real_K; k++) {
+                    x[v * real_K + k] = static_cast<T>(short_N ? *vectors.at(k0 + k, v) : *vectors.at(v, k0 + k));
+                }
+            }
+        }
+
+        // the rows of the long operand run along K unless it is transposed (op(A)) or not (op(B))
+        const bool axpy = short_N ? matrix.transposed : !matrix.transposed;
+        const skinny_output<T> out{alpha, beta, C, short_N ? ldc : 1, short_N ? 1 : ldc};
+        const skinny_function<T, S> kernel = skinny_kernels<T, S>[axpy][NV - 1];
+
+        const int step = post.active() ? skinny_epilogue_chunk : chunk;
+        const auto apply_post = [&](const int piece, const int end) {
+            if (!post.active()) {
+                return;
+            }
+            if (short_N) {
+                post.from(piece, 0).apply(end - piece, N, C + piece * ldc, ldc);
+            } else {
+                post.from(0, piece).apply(M, end - piece, C + piece, ldc);
+            }
+        };
+
+        if (parts == 1) {
+            parallel_for(nb_chunks, nb_threads, [=, &apply_post](const int task, int) {
+                const int first = task * chunk;
+                const int last = std::min(length, first + chunk);
+                for (int piece = first; piece < last; piece += step) {
+                    const int end = std::min(last, piece + step);
+                    kernel(piece, end, K, matrix.data, matrix.ld, work, out);
+                    apply_post(piece, end);
+                }
+            });
+            return;
+        }
+
+        // each (chunk, part of K) task writes its partial output vectors (NV vectors of `length` elements per part)
+        T* partials = work + static_cast<std::size_t>(NV) * K;
+        parallel_for(nb_chunks * parts, nb_threads, [=](const int task, int) {
+            const int p = task / nb_chunks;
+            const int first = (task % nb_chunks) * chunk;
+            const int last = std::min(length, first + chunk);
+            const int k0 = p * part_K;
+            const int real_K = std::min(K - k0, part_K);
+            const S* data = matrix.data + static_cast<std::size_t>(k0) * (axpy ? matrix.ld : 1);
+            const skinny_output<T> partial{T{1}, T{0}, partials + static_cast<std::size_t>(p) * NV * length, 1, length};
+            kernel(first, last, real_K, data, matrix.ld, work + static_cast<std::size_t>(NV) * k0, partial);
+        });
+
+        // the partial vectors are summed in a fixed order, so the result does not depend on the threads
+        parallel_for(nb_chunks, nb_threads, [=, &apply_post](const int task, int) {
+            const int first = task * chunk;
+            const int last = std::min(length, first + chunk);
+            for (int piece = first; piece < last; piece += step) {
+                const int end = std::min(last, piece + step);
+                for (int v = 0; v < NV; v++) {
+                    for (int j = piece; j < end; j++) {
+                        T sum = 0;
+                        for (int p = 0; p < parts; p++) {
+                            sum += partials[(static_cast<std::size_t>(p) * NV + v) * length + j];
+                        }
+                        out.store(j, v, sum);
+                    }
+                }
+                apply_post(piece, end);
+            }
+        });
+    }
+} // namespace gemm::detail
+
+#endif
@@ -12,8 +12,11 @@
 
 namespace gemm::detail
 {
+    /**
+     * @brief A kernel computes `c = alpha * ab + beta * c`, `c` being read only if `beta` is not 0.
+     */
     template<typename T>
-    using kernel = void (*)(const T*, int, const T*, int, T*, int);
+    using kernel = void (*)(T, const T*, int, const T*, int, T, T*, int);
 
     template<typename T>
     constexpr kernel<T> get_kernel(const int M, const int N, const int K);
@@ -56,13 +59,14 @@ namespace gemm::detail
 
     /**
      * @brief Creates a kernel which can multiply MxK and KxN matrices.
-     * This function combines multiple handwritten kernels in order to handle other dimensions.
+     * This function combines multiple handwritten kernels in order to handle other dimensions. When splitting
+     * along K, only the first part scales `c` by `beta`, the following ones accumulate in it.
      */
     template<typename T, int M, int N, int K>
         requires(M > 0 && N > 0 && K > 0)
-    constexpr void composed_kernel(const T* a, int lda, const T* b, int ldb, T* c, int ldc) {
+    constexpr void composed_kernel(const T alpha, const T* a, int lda, const T* b, int ldb, const T beta, T* c, int ldc) {
         if constexpr (is_handwritten_kernel(M, N, K)) {
-            get_kernel<T>(M, N, K)(a, lda, b, ldb, c, ldc);
+            get_kernel<T>(M, N, K)(alpha, a, lda, b, ldb, beta, c, ldc);
         } else {
             constexpr auto split_dim = std::max({
                 M * !is_handwritten_M(M),
@@ -72,16 +76,16 @@ namespace gemm::detail
 
             if constexpr (split_dim == M) {
                 constexpr auto split = get_previous_valid_value(M, is_handwritten_M);
-                composed_kernel<T, split, N, K>(a, lda, b, ldb, c, ldc);
-                composed_kernel<T, M - split, N, K>(a + split * lda, lda, b, ldb, c + split * ldc, ldc);
+                composed_kernel<T, split, N, K>(alpha, a, lda, b, ldb, beta, c, ldc);
+                composed_kernel<T, M - split, N, K>(alpha, a + split * lda, lda, b, ldb, beta, c + split * ldc, ldc);
             } else if constexpr (split_dim == N) {
                 constexpr auto split = get_previous_valid_value(N, is_handwritten_N);
-                composed_kernel<T, M, split, K>(a, lda, b, ldb, c, ldc);
-                composed_kernel<T, M, N - split, K>(a, lda, b + split, ldb, c + split, ldc);
+                composed_kernel<T, M, split, K>(alpha, a, lda, b, ldb, beta, c, ldc);
+                composed_kernel<T, M, N - split, K>(alpha, a, lda, b + split, ldb, beta, c + split, ldc);
             } else { // split_dim == K
                 constexpr auto split = get_previous_valid_value(K, is_handwritten_K);
-                composed_kernel<T, M, N, split>(a, lda, b, ldb, c, ldc);
-                composed_kernel<T, M, N, K - split>(a + split, lda, b + split * ldb, ldb, c, ldc);
+                composed_kernel<T, M, N, split>(alpha, a, lda, b, ldb, beta, c, ldc);
+                composed_kernel<T, M, N, K - split>(alpha, a + split, lda, b + split * ldb, ldb, T{1}, c, ldc);
             }
         }
     }
@@ -3,6 +3,8 @@
 
 #include <eve/eve.hpp>
 
+#include "update.hpp"
+
 namespace gemm::detail
 {
     ///////////////////////////////////////
@@ -10,38 +12,38 @@ namespace gemm::detail
     ///////////////////////////////////////
 
     template<typename T>
-    void kernel_211(const T* a, const int stride_a, const T* b, const int /* stride_b */, T* c, const int stride_c) {
-        c[0] += a[0] * *b;
-        c[stride_c] += a[stride_a] * *b;
+    void kernel_211(const T alpha, const T* a, const int stride_a, const T* b, const int /* stride_b */, const T beta, T* c, const int stride_c) {
+        update(alpha, a[0] * *b, beta, c);
+        update(alpha, a[stride_a] * *b, beta, c + stride_c);
     }
 
     template<typename T>
-    void kernel_212(const T* a, const int stride_a, const T* b, const int /* stride_b */, T* c, const int stride_c) {
+    void kernel_212(const T alpha, const T* a, const int stride_a, const T* b, const int /* stride_b */, const T beta, T* c, const int stride_c) {
         // TODO ?
-        c[0] += a[0] * b[0];
-        c[1] += a[0] * b[1];
-        c[stride_c] += a[stride_a] * b[0];
-        c[stride_c + 1] += a[stride_a] * b[1];
+        update(alpha, a[0] * b[0], beta, c);
+        update(alpha, a[0] * b[1], beta, c + 1);
+        update(alpha, a[stride_a] * b[0], beta, c + stride_c);
+        update(alpha, a[stride_a] * b[1], beta, c + stride_c + 1);
     }
 
     template<typename T>
-    void kernel_214(const T* a, const int stride_a, const T* b, const int /* stride_b */, T* c, const int stride_c) {
+    void kernel_214(const T alpha, const T* a, const int stride_a, const T* b, const int /* stride_b */, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<4>>;
         const wide_t wb{b};
-        const wide_t wc0 = eve::fma(a[0], wb, wide_t{c});
-        const wide_t wc1 = eve::fma(a[stride_a], wide_t{b}, wide_t{c + stride_c});
-        eve::store(wc0, c);
-        eve::store(wc1, c + stride_c);
+        const wide_t wab0 = a[0] * wb;
+        const wide_t wab1 = a[stride_a] * wide_t{b};
+        update(alpha, wab0, beta, c);
+        update(alpha, wab1, beta, c + stride_c);
     }
 
     template<typename T>
-    void kernel_218(const T* a, const int stride_a, const T* b, const int /* stride_b */, T* c, const int stride_c) {
+    void kernel_218(const T alpha, const T* a, const int stride_a, const T* b, const int /* stride_b */, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<8>>;
         const wide_t wb{b};
-        const wide_t wc0 = eve::fma(a[0], wb, wide_t{c});
-        const wide_t wc1 = eve::fma(a[stride_a], wide_t{b}, wide_t{c + stride_c});
-        eve::store(wc0, c);
-        eve::store(wc1, c + stride_c);
+        const wide_t wab0 = a[0] * wb;
+        const wide_t wab1 = a[stride_a] * wide_t{b};
+        update(alpha, wab0, beta, c);
+        update(alpha, wab1, beta, c + stride_c);
     }
 
     ///////////////////////////////////////
@@ -49,13 +51,13 @@ namespace gemm::detail
     ///////////////////////////////////////
 
     template<typename T>
-    void kernel_221(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
-        c[0] += a[0] * b[0] + a[1] * b[stride_b];
-        c[stride_c] += a[stride_a] * b[0] + a[stride_a + 1] * b[stride_b];
+    void kernel_221(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
+        update(alpha, a[0] * b[0] + a[1] * b[stride_b], beta, c);
+        update(alpha, a[stride_a] * b[0] + a[stride_a + 1] * b[stride_b], beta, c + stride_c);
     }
 
     template<typename T>
-    void kernel_222(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
+    void kernel_222(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<4>>;
         const wide_t wa{a[0], a[1], a[stride_a], a[stride_a + 1]};
         const wide_t wb{b[0], b[1], b[stride_b], b[stride_b + 1]};
@@ -66,14 +68,14 @@ namespace gemm::detail
         const auto b1 = eve::shuffle(wb, eve::pattern<2, 3, 2, 3>);
         const auto res = eve::fma(a0, b0, a1 * b1);
 
-        c[0] += res.get(0);
-        c[1] += res.get(1);
-        c[stride_c] += res.get(2);
-        c[stride_c + 1] += res.get(3);
+        update(alpha, res.get(0), beta, c);
+        update(alpha, res.get(1), beta, c + 1);
+        update(alpha, res.get(2), beta, c + stride_c);
+        update(alpha, res.get(3), beta, c + stride_c + 1);
     }
 
     template<typename T>
-    void kernel_224(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
+    void kernel_224(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<4>>;
         const wide_t wb0{b};
         const wide_t wb1{b + stride_b};
@@ -81,12 +83,12 @@ namespace gemm::detail
         const auto wab0 = eve::fma(a[0], wb0, a[1] * wb1);
         const auto wab1 = eve::fma(a[stride_a], wb0, a[stride_a + 1] * wb1);
 
-        eve::store(wab0 + wide_t{c}, c);
-        eve::store(wab1 + wide_t{c + stride_c}, c + stride_c);
+        update(alpha, wab0, beta, c);
+        update(alpha, wab1, beta, c + stride_c);
     }
 
     template<typename T>
-    void kernel_228(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
+    void kernel_228(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<8>>;
         const wide_t wb0{b};
         const wide_t wb1{b + stride_b};
@@ -94,8 +96,8 @@ namespace gemm::detail
         const auto wab0 = eve::fma(a[0], wb0, a[1] * wb1);
         const auto wab1 = eve::fma(a[stride_a], wb0, a[stride_a + 1] * wb1);
 
-        eve::store(wab0 + wide_t{c}, c);
-        eve::store(wab1 + wide_t{c + stride_c}, c + stride_c);
+        update(alpha, wab0, beta, c);
+        update(alpha, wab1, beta, c + stride_c);
     }
 
     ///////////////////////////////////////
@@ -103,32 +105,32 @@ namespace gemm::detail
     ///////////////////////////////////////
 
     template<typename T>
-    void kernel_241(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
+    void kernel_241(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<4>>;
         const wide_t wa0{a};
         const wide_t wa1{a + stride_a};
         const wide_t wb{b[0], b[stride_b], b[2 * stride_b], b[3 * stride_b]};
 
-        c[0] += eve::reduce(wa0 * wb);
-        c[stride_c] += eve::reduce(wa1 * wb);
+        update(alpha, eve::reduce(wa0 * wb), beta, c);
+        update(alpha, eve::reduce(wa1 * wb), beta, c + stride_c);
     }
 
     template<typename T>
-    void kernel_242(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
+    void kernel_242(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<4>>;
         const wide_t wa0{a};
         const wide_t wa1{a + stride_a};
         const wide_t wb0{b[0], b[stride_b], b[2 * stride_b], b[3 * stride_b]};
         const wide_t wb1{b[1], b[stride_b + 1], b[2 * stride_b + 1], b[3 * stride_b + 1]};
 
-        c[0] += eve::reduce(wa0 * wb0);
-        c[1] += eve::reduce(wa0 * wb1);
-        c[stride_c] += eve::reduce(wa1 * wb0);
-        c[stride_c + 1] += eve::reduce(wa1 * wb1);
+        update(alpha, eve::reduce(wa0 * wb0), beta, c);
+        update(alpha, eve::reduce(wa0 * wb1), beta, c + 1);
+        update(alpha, eve::reduce(wa1 * wb0), beta, c + stride_c);
+        update(alpha, eve::reduce(wa1 * wb1), beta, c + stride_c + 1);
     }
 
     template<typename T>
-    void kernel_244(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
+    void kernel_244(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<4>>;
         const wide_t wb0{b};
         const wide_t wb1{b + stride_b};
@@ -137,15 +139,15 @@ namespace gemm::detail
 
         const auto c11 = eve::fma(a[0], wb0, a[1] * wb1);
         const auto c12 = eve::fma(a[2], wb2, a[3] * wb3);
-        eve::store(wide_t{c} + c11 + c12, c);
+        update(alpha, c11 + c12, beta, c);
 
         const auto c21 = eve::fma(a[stride_a], wb0, a[stride_a + 1] * wb1);
         const auto c22 = eve::fma(a[stride_a + 2], wb2, a[stride_a + 3] * wb3);
-        eve::store(wide_t{c + stride_c} + c21 + c22, c + stride_c);
+        update(alpha, c21 + c22, beta, c + stride_c);
     }
 
     template<typename T>
-    void kernel_248(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
+    void kernel_248(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<8>>;
         const wide_t wb0{b};
         const wide_t wb1{b + stride_b};
@@ -154,11 +156,11 @@ namespace gemm::detail
 
         const auto c11 = eve::fma(a[0], wb0, a[1] * wb1);
         const auto c12 = eve::fma(a[2], wb2, a[3] * wb3);
-        eve::store(wide_t{c} + c11 + c12, c);
+        update(alpha, c11 + c12, beta, c);
 
         const auto c21 = eve::fma(a[stride_a], wb0, a[stride_a + 1] * wb1);
         const auto c22 = eve::fma(a[stride_a + 2], wb2, a[stride_a + 3] * wb3);
-        eve::store(wide_t{c + stride_c} + c21 + c22, c + stride_c);
+        update(alpha, c21 + c22, beta, c + stride_c);
     }
 
     ///////////////////////////////////////
@@ -166,18 +168,18 @@ namespace gemm::detail
     ///////////////////////////////////////
 
     template<typename T>
-    void kernel_281(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
+    void kernel_281(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<8>>;
         const wide_t wa1{a};
         const wide_t wa2{a + stride_a};
         const wide_t wb{[=](auto i, auto) { return b[i * stride_b]; }};
 
-        c[0] += eve::reduce(wa1 * wb);
-        c[stride_c] += eve::reduce(wa2 * wb);
+        update(alpha, eve::reduce(wa1 * wb), beta, c);
+        update(alpha, eve::reduce(wa2 * wb), beta, c + stride_c);
     }
 
     template<typename T>
-    void kernel_282(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
+    void kernel_282(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<4>>;
 
         const wide_t wa0 = wide_t{a[0], a[0], a[stride_a], a[stride_a]};
@@ -205,14 +207,14 @@ namespace gemm::detail
         const wide_t wc3 = eve::fma(wa6, wb6, wa7 * wb7);
 
         const auto res = wc0 + wc1 + wc2 + wc3;
-        c[0] += res.get(0);
-        c[1] += res.get(1);
-        c[stride_c] += res.get(2);
-        c[stride_c + 1] += res.get(3);
+        update(alpha, res.get(0), beta, c);
+        update(alpha, res.get(1), beta, c + 1);
+        update(alpha, res.get(2), beta, c + stride_c);
+        update(alpha, res.get(3), beta, c + stride_c + 1);
     }
 
     template<typename T>
-    void kernel_284(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
+    void kernel_284(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<4>>;
 
         const wide_t wb0{b};
@@ -234,12 +236,12 @@ namespace gemm::detail
         const auto wab12 = eve::fma(a[stride_a + 4], wb4, a[stride_a + 5] * wb5);
         const auto wab13 = eve::fma(a[stride_a + 6], wb6, a[stride_a + 7] * wb7);
 
-        eve::store(wide_t{c} + wab00 + wab01 + wab02 + wab03, c);
-        eve::store(wide_t{c + stride_c} + wab10 + wab11 + wab12 + wab13, c + stride_c);
+        update(alpha, wab00 + wab01 + wab02 + wab03, beta, c);
+        update(alpha, wab10 + wab11 + wab12 + wab13, beta, c + stride_c);
     }
 
     template<typename T>
-    void kernel_288(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
+    void kernel_288(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<8>>;
 
         const wide_t wb0{b};
@@ -261,8 +263,8 @@ namespace gemm::detail
         const auto wab12 = eve::fma(a[stride_a + 4], wb4, a[stride_a + 5] * wb5);
         const auto wab13 = eve::fma(a[stride_a + 6], wb6, a[stride_a + 7] * wb7);
 
-        eve::store(wide_t{c} + wab00 + wab01 + wab02 + wab03, c);
-        eve::store(wide_t{c + stride_c} + wab10 + wab11 + wab12 + wab13, c + stride_c);
+        update(alpha, wab00 + wab01 + wab02 + wab03, beta, c);
+        update(alpha, wab10 + wab11 + wab12 + wab13, beta, c + stride_c);
     }
 } // namespace gemm::detail
 
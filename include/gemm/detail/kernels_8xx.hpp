@@ -3,6 +3,8 @@
 
 #include <eve/eve.hpp>
 
+#include "update.hpp"
+
 namespace gemm::detail
 {
     ///////////////////////////////////////
@@ -10,7 +12,7 @@ namespace gemm::detail
     ///////////////////////////////////////
 
     template<typename T>
-    void kernel_811(const T* a, const int stride_a, const T* b, const int /* stride_b */, T* c, const int stride_c) {
+    void kernel_811(const T alpha, const T* a, const int stride_a, const T* b, const int /* stride_b */, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<4>>;
         const wide_t wb{*b};
 
@@ -19,18 +21,18 @@ namespace gemm::detail
         const wide_t wa1 = wide_t{[=](auto i, auto) { return a[(i + 4) * stride_a]; }};
         const wide_t wab1 = wa1 * wb;
 
-        c[0] += wab0.get(0);
-        c[stride_c] += wab0.get(1);
-        c[2 * stride_c] += wab0.get(2);
-        c[3 * stride_c] += wab0.get(3);
-        c[4 * stride_c] += wab1.get(0);
-        c[5 * stride_c] += wab1.get(1);
-        c[6 * stride_c] += wab1.get(2);
-        c[7 * stride_c] += wab1.get(3);
+        update(alpha, wab0.get(0), beta, c);
+        update(alpha, wab0.get(1), beta, c + stride_c);
+        update(alpha, wab0.get(2), beta, c + 2 * stride_c);
+        update(alpha, wab0.get(3), beta, c + 3 * stride_c);
+        update(alpha, wab1.get(0), beta, c + 4 * stride_c);
+        update(alpha, wab1.get(1), beta, c + 5 * stride_c);
+        update(alpha, wab1.get(2), beta, c + 6 * stride_c);
+        update(alpha, wab1.get(3), beta, c + 7 * stride_c);
     }
 
     template<typename T>
-    void kernel_812(const T* a, const int stride_a, const T* b, const int /* stride_b */, T* c, const int stride_c) {
+    void kernel_812(const T alpha, const T* a, const int stride_a, const T* b, const int /* stride_b */, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<4>>;
         const wide_t wb{b[0], b[1], b[0], b[1]};
         const wide_t wa0{a[0], a[0], a[stride_a], a[stride_a]};
@@ -43,52 +45,52 @@ namespace gemm::detail
         const auto wab2 = wa2 * wb;
         const auto wab3 = wa3 * wb;
 
-        c[0] += wab0.get(0);
-        c[1] += wab0.get(1);
-        c[stride_c] += wab0.get(2);
-        c[stride_c + 1] += wab0.get(3);
-        c[2 * stride_c] += wab1.get(0);
-        c[2 * stride_c + 1] += wab1.get(1);
-        c[3 * stride_c] += wab1.get(2);
-        c[3 * stride_c + 1] += wab1.get(3);
-        c[4 * stride_c] += wab2.get(0);
-        c[4 * stride_c + 1] += wab2.get(1);
-        c[5 * stride_c] += wab2.get(2);
-        c[5 * stride_c + 1] += wab2.get(3);
-        c[6 * stride_c] += wab3.get(0);
-        c[6 * stride_c + 1] += wab3.get(1);
-        c[7 * stride_c] += wab3.get(2);
-        c[7 * stride_c + 1] += wab3.get(3);
+        update(alpha, wab0.get(0), beta, c);
+        update(alpha, wab0.get(1), beta, c + 1);
+        update(alpha, wab0.get(2), beta, c + stride_c);
+        update(alpha, wab0.get(3), beta, c + stride_c + 1);
+        update(alpha, wab1.get(0), beta, c + 2 * stride_c);
+        update(alpha, wab1.get(1), beta, c + 2 * stride_c + 1);
+        update(alpha, wab1.get(2), beta, c + 3 * stride_c);
+        update(alpha, wab1.get(3), beta, c + 3 * stride_c + 1);
+        update(alpha, wab2.get(0), beta, c + 4 * stride_c);
+        update(alpha, wab2.get(1), beta, c + 4 * stride_c + 1);
+        update(alpha, wab2.get(2), beta, c + 5 * stride_c);
+        update(alpha, wab2.get(3), beta, c + 5 * stride_c + 1);
+        update(alpha, wab3.get(0), beta, c + 6 * stride_c);
+        update(alpha, wab3.get(1), beta, c + 6 * stride_c + 1);
+        update(alpha, wab3.get(2), beta, c + 7 * stride_c);
+        update(alpha, wab3.get(3), beta, c + 7 * stride_c + 1);
     }
 
     template<typename T>
-    void kernel_814(const T* a, const int stride_a, const T* b, const int /* stride_b */, T* c, const int stride_c) {
+    void kernel_814(const T alpha, const T* a, const int stride_a, const T* b, const int /* stride_b */, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<4>>;
         const wide_t wb{b};
 
-        eve::store(eve::fma(a[0], wb, wide_t{c}), c);
-        eve::store(eve::fma(a[stride_a], wb, wide_t{c + stride_c}), c + stride_c);
-        eve::store(eve::fma(a[2 * stride_a], wb, wide_t{c + 2 * stride_c}), c + 2 * stride_c);
-        eve::store(eve::fma(a[3 * stride_a], wb, wide_t{c + 3 * stride_c}), c + 3 * stride_c);
-        eve::store(eve::fma(a[4 * stride_a], wb, wide_t{c + 4 * stride_c}), c + 4 * stride_c);
-        eve::store(eve::fma(a[5 * stride_a], wb, wide_t{c + 5 * stride_c}), c + 5 * stride_c);
-        eve::store(eve::fma(a[6 * stride_a], wb, wide_t{c + 6 * stride_c}), c + 6 * stride_c);
-        eve::store(eve::fma(a[7 * stride_a], wb, wide_t{c + 7 * stride_c}), c + 7 * stride_c);
+        update(alpha, a[0] * wb, beta, c);
+        update(alpha, a[stride_a] * wb, beta, c + stride_c);
+        update(alpha, a[2 * stride_a] * wb, beta, c + 2 * stride_c);
+        update(alpha, a[3 * stride_a] * wb, beta, c + 3 * stride_c);
+        update(alpha, a[4 * stride_a] * wb, beta, c + 4 * stride_c);
+        update(alpha, a[5 * stride_a] * wb, beta, c + 5 * stride_c);
+        update(alpha, a[6 * stride_a] * wb, beta, c + 6 * stride_c);
+        update(alpha, a[7 * stride_a] * wb, beta, c + 7 * stride_c);
     }
 
     template<typename T>
-    void kernel_818(const T* a, const int stride_a, const T* b, const int /* stride_b */, T* c, const int stride_c) {
+    void kernel_818(const T alpha, const T* a, const int stride_a, const T* b, const int /* stride_b */, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<8>>;
         const wide_t wb{b};
 
-        eve::store(eve::fma(a[0], wb, wide_t{c}), c);
-        eve::store(eve::fma(a[stride_a], wb, wide_t{c + stride_c}), c + stride_c);
-        eve::store(eve::fma(a[2 * stride_a], wb, wide_t{c + 2 * stride_c}), c + 2 * stride_c);
-        eve::store(eve::fma(a[3 * stride_a], wb, wide_t{c + 3 * stride_c}), c + 3 * stride_c);
-        eve::store(eve::fma(a[4 * stride_a], wb, wide_t{c + 4 * stride_c}), c + 4 * stride_c);
-        eve::store(eve::fma(a[5 * stride_a], wb, wide_t{c + 5 * stride_c}), c + 5 * stride_c);
-        eve::store(eve::fma(a[6 * stride_a], wb, wide_t{c + 6 * stride_c}), c + 6 * stride_c);
-        eve::store(eve::fma(a[7 * stride_a], wb, wide_t{c + 7 * stride_c}), c + 7 * stride_c);
+        update(alpha, a[0] * wb, beta, c);
+        update(alpha, a[stride_a] * wb, beta, c + stride_c);
+        update(alpha, a[2 * stride_a] * wb, beta, c + 2 * stride_c);
+        update(alpha, a[3 * stride_a] * wb, beta, c + 3 * stride_c);
+        update(alpha, a[4 * stride_a] * wb, beta, c + 4 * stride_c);
+        update(alpha, a[5 * stride_a] * wb, beta, c + 5 * stride_c);
+        update(alpha, a[6 * stride_a] * wb, beta, c + 6 * stride_c);
+        update(alpha, a[7 * stride_a] * wb, beta, c + 7 * stride_c);
     }
 
     ///////////////////////////////////////
@@ -96,31 +98,31 @@ namespace gemm::detail
     ///////////////////////////////////////
 
     template<typename T>
-    void kernel_821(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
+    void kernel_821(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<8>>;
         const wide_t wa0{[=](auto i, auto) { return a[i * stride_a]; }};
         const wide_t wa1{[=](auto i, auto) { return a[i * stride_a + 1]; }};
         const auto wab = eve::fma(wa0, b[0], wa1 * b[stride_b]);
 
-        c[0] += wab.get(0);
-        c[stride_c] += wab.get(1);
-        c[2 * stride_c] += wab.get(2);
-        c[3 * stride_c] += wab.get(3);
-        c[4 * stride_c] += wab.get(4);
-        c[5 * stride_c] += wab.get(5);
-        c[6 * stride_c] += wab.get(6);
-        c[7 * stride_c] += wab.get(7);
+        update(alpha, wab.get(0), beta, c);
+        update(alpha, wab.get(1), beta, c + stride_c);
+        update(alpha, wab.get(2), beta, c + 2 * stride_c);
+        update(alpha, wab.get(3), beta, c + 3 * stride_c);
+        update(alpha, wab.get(4), beta, c + 4 * stride_c);
+        update(alpha, wab.get(5), beta, c + 5 * stride_c);
+        update(alpha, wab.get(6), beta, c + 6 * stride_c);
+        update(alpha, wab.get(7), beta, c + 7 * stride_c);
     }
 
     template<typename T>
-    void kernel_822(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
+    void kernel_822(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
         // TODO
-        kernel_422(a, stride_a, b, stride_b, c, stride_c);
-        kernel_422(a + 4 * stride_a, stride_a, b, stride_b, c + 4 * stride_c, stride_c);
+        kernel_422(alpha, a, stride_a, b, stride_b, beta, c, stride_c);
+        kernel_422(alpha, a + 4 * stride_a, stride_a, b, stride_b, beta, c + 4 * stride_c, stride_c);
     }
 
     template<typename T>
-    void kernel_824(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
+    void kernel_824(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<4>>;
         const wide_t wb0{b};
         const wide_t wb1{b + stride_b};
@@ -134,18 +136,18 @@ namespace gemm::detail
         const auto wab6 = eve::fma(a[6 * stride_a], wb0, a[6 * stride_a + 1] * wb1);
         const auto wab7 = eve::fma(a[7 * stride_a], wb0, a[7 * stride_a + 1] * wb1);
 
-        eve::store(wide_t{c} + wab0, c);
-        eve::store(wide_t{c + stride_c} + wab1, c + stride_c);
-        eve::store(wide_t{c + 2 * stride_c} + wab2, c + 2 * stride_c);
-        eve::store(wide_t{c + 3 * stride_c} + wab3, c + 3 * stride_c);
-        eve::store(wide_t{c + 4 * stride_c} + wab4, c + 4 * stride_c);
-        eve::store(wide_t{c + 5 * stride_c} + wab5, c + 5 * stride_c);
-        eve::store(wide_t{c + 6 * stride_c} + wab6, c + 6 * stride_c);
-        eve::store(wide_t{c + 7 * stride_c} + wab7, c + 7 * stride_c);
+        update(alpha, wab0, beta, c);
+        update(alpha, wab1, beta, c + stride_c);
+        update(alpha, wab2, beta, c + 2 * stride_c);
+        update(alpha, wab3, beta, c + 3 * stride_c);
+        update(alpha, wab4, beta, c + 4 * stride_c);
+        update(alpha, wab5, beta, c + 5 * stride_c);
+        update(alpha, wab6, beta, c + 6 * stride_c);
+        update(alpha, wab7, beta, c + 7 * stride_c);
     }
 
     template<typename T>
-    void kernel_828(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
+    void kernel_828(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<8>>;
         const wide_t wb0{b};
         const wide_t wb1{b + stride_b};
@@ -159,14 +161,14 @@ namespace gemm::detail
         const auto wab6 = eve::fma(a[6 * stride_a], wb0, a[6 * stride_a + 1] * wb1);
         const auto wab7 = eve::fma(a[7 * stride_a], wb0, a[7 * stride_a + 1] * wb1);
 
-        eve::store(wide_t{c} + wab0, c);
-        eve::store(wide_t{c + stride_c} + wab1, c + stride_c);
-        eve::store(wide_t{c + 2 * stride_c} + wab2, c + 2 * stride_c);
-        eve::store(wide_t{c + 3 * stride_c} + wab3, c + 3 * stride_c);
-        eve::store(wide_t{c + 4 * stride_c} + wab4, c + 4 * stride_c);
-        eve::store(wide_t{c + 5 * stride_c} + wab5, c + 5 * stride_c);
-        eve::store(wide_t{c + 6 * stride_c} + wab6, c + 6 * stride_c);
-        eve::store(wide_t{c + 7 * stride_c} + wab7, c + 7 * stride_c);
+        update(alpha, wab0, beta, c);
+        update(alpha, wab1, beta, c + stride_c);
+        update(alpha, wab2, beta, c + 2 * stride_c);
+        update(alpha, wab3, beta, c + 3 * stride_c);
+        update(alpha, wab4, beta, c + 4 * stride_c);
+        update(alpha, wab5, beta, c + 5 * stride_c);
+        update(alpha, wab6, beta, c + 6 * stride_c);
+        update(alpha, wab7, beta, c + 7 * stride_c);
     }
 
     ///////////////////////////////////////
@@ -175,46 +177,46 @@ namespace gemm::detail
 
 
     template<typename T>
-    void kernel_841(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
+    void kernel_841(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<4>>;
         const wide_t wb{[=](auto i, auto) { return b[i * stride_b]; }};
 
-        c[0] += eve::reduce(wide_t{a} * wb);
-        c[stride_c] += eve::reduce(wide_t{a + stride_a} * wb);
-        c[2 * stride_c] += eve::reduce(wide_t{a + 2 * stride_a} * wb);
-        c[3 * stride_c] += eve::reduce(wide_t{a + 3 * stride_a} * wb);
-        c[4 * stride_c] += eve::reduce(wide_t{a + 4 * stride_a} * wb);
-        c[5 * stride_c] += eve::reduce(wide_t{a + 5 * stride_a} * wb);
-        c[6 * stride_c] += eve::reduce(wide_t{a + 6 * stride_a} * wb);
-        c[7 * stride_c] += eve::reduce(wide_t{a + 7 * stride_a} * wb);
+        update(alpha, eve::reduce(wide_t{a} * wb), beta, c);
+        update(alpha, eve::reduce(wide_t{a + stride_a} * wb), beta, c + stride_c);
+        update(alpha, eve::reduce(wide_t{a + 2 * stride_a} * wb), beta, c + 2 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 3 * stride_a} * wb), beta, c + 3 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 4 * stride_a} * wb), beta, c + 4 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 5 * stride_a} * wb), beta, c + 5 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 6 * stride_a} * wb), beta, c + 6 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 7 * stride_a} * wb), beta, c + 7 * stride_c);
     }
 
     template<typename T>
-    void kernel_842(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
+    void kernel_842(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<4>>;
         const wide_t wb0{[=](auto i, auto) { return b[i * stride_b]; }};
         const wide_t wb1{[=](auto i, auto) { return b[i * stride_b + 1]; }};
 
-        c[0] += eve::reduce(wide_t{a} * wb0);
-        c[1] += eve::reduce(wide_t{a} * wb1);
-        c[stride_c] += eve::reduce(wide_t{a + stride_a} * wb0);
-        c[stride_c + 1] += eve::reduce(wide_t{a + stride_a} * wb1);
-        c[2 * stride_c] += eve::reduce(wide_t{a + 2 * stride_a} * wb0);
-        c[2 * stride_c + 1] += eve::reduce(wide_t{a + 2 * stride_a} * wb1);
-        c[3 * stride_c] += eve::reduce(wide_t{a + 3 * stride_a} * wb0);
-        c[3 * stride_c + 1] += eve::reduce(wide_t{a + 3 * stride_a} * wb1);
-        c[4 * stride_c] += eve::reduce(wide_t{a + 4 * stride_a} * wb0);
-        c[4 * stride_c + 1] += eve::reduce(wide_t{a + 4 * stride_a} * wb1);
-        c[5 * stride_c] += eve::reduce(wide_t{a + 5 * stride_a} * wb0);
-        c[5 * stride_c + 1] += eve::reduce(wide_t{a + 5 * stride_a} * wb1);
-        c[6 * stride_c] += eve::reduce(wide_t{a + 6 * stride_a} * wb0);
-        c[6 * stride_c + 1] += eve::reduce(wide_t{a + 6 * stride_a} * wb1);
-        c[7 * stride_c] += eve::reduce(wide_t{a + 7 * stride_a} * wb0);
-        c[7 * stride_c + 1] += eve::reduce(wide_t{a + 7 * stride_a} * wb1);
+        update(alpha, eve::reduce(wide_t{a} * wb0), beta, c);
+        update(alpha, eve::reduce(wide_t{a} * wb1), beta, c + 1);
+        update(alpha, eve::reduce(wide_t{a + stride_a} * wb0), beta, c + stride_c);
+        update(alpha, eve::reduce(wide_t{a + stride_a} * wb1), beta, c + stride_c + 1);
+        update(alpha, eve::reduce(wide_t{a + 2 * stride_a} * wb0), beta, c + 2 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 2 * stride_a} * wb1), beta, c + 2 * stride_c + 1);
+        update(alpha, eve::reduce(wide_t{a + 3 * stride_a} * wb0), beta, c + 3 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 3 * stride_a} * wb1), beta, c + 3 * stride_c + 1);
+        update(alpha, eve::reduce(wide_t{a + 4 * stride_a} * wb0), beta, c + 4 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 4 * stride_a} * wb1), beta, c + 4 * stride_c + 1);
+        update(alpha, eve::reduce(wide_t{a + 5 * stride_a} * wb0), beta, c + 5 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 5 * stride_a} * wb1), beta, c + 5 * stride_c + 1);
+        update(alpha, eve::reduce(wide_t{a + 6 * stride_a} * wb0), beta, c + 6 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 6 * stride_a} * wb1), beta, c + 6 * stride_c + 1);
+        update(alpha, eve::reduce(wide_t{a + 7 * stride_a} * wb0), beta, c + 7 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 7 * stride_a} * wb1), beta, c + 7 * stride_c + 1);
     }
 
     template<typename T>
-    void kernel_844(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
+    void kernel_844(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<4>>;
         const wide_t wb0{b};
         const wide_t wb1{b + stride_b};
@@ -223,39 +225,39 @@ namespace gemm::detail
 
         const auto wab0 = eve::fma(a[0], wb0, a[1] * wb1);
         const auto wab1 = eve::fma(a[2], wb2, a[3] * wb3);
-        eve::store(wide_t{c} + wab0 + wab1, c);
+        update(alpha, wab0 + wab1, beta, c);
 
         const auto wab2 = eve::fma(a[stride_a], wb0, a[stride_a + 1] * wb1);
         const auto wab3 = eve::fma(a[stride_a + 2], wb2, a[stride_a + 3] * wb3);
-        eve::store(wide_t{c + stride_c} + wab2 + wab3, c + stride_c);
+        update(alpha, wab2 + wab3, beta, c + stride_c);
 
         const auto wab4 = eve::fma(a[2 * stride_a], wb0, a[2 * stride_a + 1] * wb1);
         const auto wab5 = eve::fma(a[2 * stride_a + 2], wb2, a[2 * stride_a + 3] * wb3);
-        eve::store(wide_t{c + 2 * stride_c} + wab4 + wab5, c + 2 * stride_c);
+        update(alpha, wab4 + wab5, beta, c + 2 * stride_c);
 
         const auto wab6 = eve::fma(a[3 * stride_a], wb0, a[3 * stride_a + 1] * wb1);
         const auto wab7 = eve::fma(a[3 * stride_a + 2], wb2, a[3 * stride_a + 3] * wb3);
-        eve::store(wide_t{c + 3 * stride_c} + wab6 + wab7, c + 3 * stride_c);
+        update(alpha, wab6 + wab7, beta, c + 3 * stride_c);
 
         const auto wab8 = eve::fma(a[4 * stride_a], wb0, a[4 * stride_a + 1] * wb1);
         const auto wab9 = eve::fma(a[4 * stride_a + 2], wb2, a[4 * stride_a + 3] * wb3);
-        eve::store(wide_t{c + 4 * stride_c} + wab8 + wab9, c + 4 * stride_c);
+        update(alpha, wab8 + wab9, beta, c + 4 * stride_c);
 
         const auto wab10 = eve::fma(a[5 * stride_a], wb0, a[5 * stride_a + 1] * wb1);
         const auto wab11 = eve::fma(a[5 * stride_a + 2], wb2, a[5 * stride_a + 3] * wb3);
-        eve::store(wide_t{c + 5 * stride_c} + wab10 + wab11, c + 5 * stride_c);
+        update(alpha, wab10 + wab11, beta, c + 5 * stride_c);
 
         const auto wab12 = eve::fma(a[6 * stride_a], wb0, a[6 * stride_a + 1] * wb1);
         const auto wab13 = eve::fma(a[6 * stride_a + 2], wb2, a[6 * stride_a + 3] * wb3);
-        eve::store(wide_t{c + 6 * stride_c} + wab12 + wab13, c + 6 * stride_c);
+        update(alpha, wab12 + wab13, beta, c + 6 * stride_c);
 
         const auto wab14 = eve::fma(a[7 * stride_a], wb0, a[7 * stride_a + 1] * wb1);
         const auto wab15 = eve::fma(a[7 * stride_a + 2], wb2, a[7 * stride_a + 3] * wb3);
-        eve::store(wide_t{c + 7 * stride_c} + wab14 + wab15, c + 7 * stride_c);
+        update(alpha, wab14 + wab15, beta, c + 7 * stride_c);
     }
 
     template<typename T>
-    void kernel_848(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
+    void kernel_848(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<8>>;
         const wide_t wb0{b};
         const wide_t wb1{b + stride_b};
@@ -264,35 +266,35 @@ namespace gemm::detail
 
         const auto wab0 = eve::fma(a[0], wb0, a[1] * wb1);
         const auto wab1 = eve::fma(a[2], wb2, a[3] * wb3);
-        eve::store(wide_t{c} + wab0 + wab1, c);
+        update(alpha, wab0 + wab1, beta, c);
 
         const auto wab2 = eve::fma(a[stride_a], wb0, a[stride_a + 1] * wb1);
         const auto wab3 = eve::fma(a[stride_a + 2], wb2, a[stride_a + 3] * wb3);
-        eve::store(wide_t{c + stride_c} + wab2 + wab3, c + stride_c);
+        update(alpha, wab2 + wab3, beta, c + stride_c);
 
         const auto wab4 = eve::fma(a[2 * stride_a], wb0, a[2 * stride_a + 1] * wb1);
         const auto wab5 = eve::fma(a[2 * stride_a + 2], wb2, a[2 * stride_a + 3] * wb3);
-        eve::store(wide_t{c + 2 * stride_c} + wab4 + wab5, c + 2 * stride_c);
+        update(alpha, wab4 + wab5, beta, c + 2 * stride_c);
 
         const auto wab6 = eve::fma(a[3 * stride_a], wb0, a[3 * stride_a + 1] * wb1);
         const auto wab7 = eve::fma(a[3 * stride_a + 2], wb2, a[3 * stride_a + 3] * wb3);
-        eve::store(wide_t{c + 3 * stride_c} + wab6 + wab7, c + 3 * stride_c);
+        update(alpha, wab6 + wab7, beta, c + 3 * stride_c);
 
         const auto wab8 = eve::fma(a[4 * stride_a], wb0, a[4 * stride_a + 1] * wb1);
         const auto wab9 = eve::fma(a[4 * stride_a + 2], wb2, a[4 * stride_a + 3] * wb3);
-        eve::store(wide_t{c + 4 * stride_c} + wab8 + wab9, c + 4 * stride_c);
+        update(alpha, wab8 + wab9, beta, c + 4 * stride_c);
 
         const auto wab10 = eve::fma(a[5 * stride_a], wb0, a[5 * stride_a + 1] * wb1);
         const auto wab11 = eve::fma(a[5 * stride_a + 2], wb2, a[5 * stride_a + 3] * wb3);
-        eve::store(wide_t{c + 5 * stride_c} + wab10 + wab11, c + 5 * stride_c);
+        update(alpha, wab10 + wab11, beta, c + 5 * stride_c);
 
         const auto wab12 = eve::fma(a[6 * stride_a], wb0, a[6 * stride_a + 1] * wb1);
         const auto wab13 = eve::fma(a[6 * stride_a + 2], wb2, a[6 * stride_a + 3] * wb3);
-        eve::store(wide_t{c + 6 * stride_c} + wab12 + wab13, c + 6 * stride_c);
+        update(alpha, wab12 + wab13, beta, c + 6 * stride_c);
 
         const auto wab14 = eve::fma(a[7 * stride_a], wb0, a[7 * stride_a + 1] * wb1);
         const auto wab15 = eve::fma(a[7 * stride_a + 2], wb2, a[7 * stride_a + 3] * wb3);
-        eve::store(wide_t{c + 7 * stride_c} + wab14 + wab15, c + 7 * stride_c);
+        update(alpha, wab14 + wab15, beta, c + 7 * stride_c);
     }
 
     ///////////////////////////////////////
@@ -300,54 +302,54 @@ namespace gemm::detail
     ///////////////////////////////////////
 
     template<typename T>
-    void kernel_881(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
+    void kernel_881(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<8>>;
         const wide_t wb{[=](auto i, auto) { return b[i * stride_b]; }};
 
-        c[0] += eve::reduce(wide_t{a} * wb);
-        c[stride_c] += eve::reduce(wide_t{a + stride_a} * wb);
-        c[2 * stride_c] += eve::reduce(wide_t{a + 2 * stride_a} * wb);
-        c[3 * stride_c] += eve::reduce(wide_t{a + 3 * stride_a} * wb);
-        c[4 * stride_c] += eve::reduce(wide_t{a + 4 * stride_a} * wb);
-        c[5 * stride_c] += eve::reduce(wide_t{a + 5 * stride_a} * wb);
-        c[6 * stride_c] += eve::reduce(wide_t{a + 6 * stride_a} * wb);
-        c[7 * stride_c] += eve::reduce(wide_t{a + 7 * stride_a} * wb);
+        update(alpha, eve::reduce(wide_t{a} * wb), beta, c);
+        update(alpha, eve::reduce(wide_t{a + stride_a} * wb), beta, c + stride_c);
+        update(alpha, eve::reduce(wide_t{a + 2 * stride_a} * wb), beta, c + 2 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 3 * stride_a} * wb), beta, c + 3 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 4 * stride_a} * wb), beta, c + 4 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 5 * stride_a} * wb), beta, c + 5 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 6 * stride_a} * wb), beta, c + 6 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 7 * stride_a} * wb), beta, c + 7 * stride_c);
     }
 
     template<typename T>
-    void kernel_882(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
+    void kernel_882(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
         using wide_t = eve::wide<T, eve::fixed<8>>;
         const wide_t wb0{[=](auto i, auto) { return b[i * stride_b]; }};
         const wide_t wb1{[=](auto i, auto) { return b[i * stride_b + 1]; }};
 
-        c[0] += eve::reduce(wide_t{a} * wb0);
-        c[1] += eve::reduce(wide_t{a} * wb1);
-        c[stride_c] += eve::reduce(wide_t{a + stride_a} * wb0);
-        c[stride_c + 1] += eve::reduce(wide_t{a + stride_a} * wb1);
-        c[2 * stride_c] += eve::reduce(wide_t{a + 2 * stride_a} * wb0);
-        c[2 * stride_c + 1] += eve::reduce(wide_t{a + 2 * stride_a} * wb1);
-        c[3 * stride_c] += eve::reduce(wide_t{a + 3 * stride_a} * wb0);
-        c[3 * stride_c + 1] += eve::reduce(wide_t{a + 3 * stride_a} * wb1);
-        c[4 * stride_c] += eve::reduce(wide_t{a + 4 * stride_a} * wb0);
-        c[4 * stride_c + 1] += eve::reduce(wide_t{a + 4 * stride_a} * wb1);
-        c[5 * stride_c] += eve::reduce(wide_t{a + 5 * stride_a} * wb0);
-        c[5 * stride_c + 1] += eve::reduce(wide_t{a + 5 * stride_a} * wb1);
-        c[6 * stride_c] += eve::reduce(wide_t{a + 6 * stride_a} * wb0);
-        c[6 * stride_c + 1] += eve::reduce(wide_t{a + 6 * stride_a} * wb1);
-        c[7 * stride_c] += eve::reduce(wide_t{a + 7 * stride_a} * wb0);
-        c[7 * stride_c + 1] += eve::reduce(wide_t{a + 7 * stride_a} * wb1);
+        update(alpha, eve::reduce(wide_t{a} * wb0), beta, c);
+        update(alpha, eve::reduce(wide_t{a} * wb1), beta, c + 1);
+        update(alpha, eve::reduce(wide_t{a + stride_a} * wb0), beta, c + stride_c);
+        update(alpha, eve::reduce(wide_t{a + stride_a} * wb1), beta, c + stride_c + 1);
+        update(alpha, eve::reduce(wide_t{a + 2 * stride_a} * wb0), beta, c + 2 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 2 * stride_a} * wb1), beta, c + 2 * stride_c + 1);
+        update(alpha, eve::reduce(wide_t{a + 3 * stride_a} * wb0), beta, c + 3 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 3 * stride_a} * wb1), beta, c + 3 * stride_c + 1);
+        update(alpha, eve::reduce(wide_t{a + 4 * stride_a} * wb0), beta, c + 4 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 4 * stride_a} * wb1), beta, c + 4 * stride_c + 1);
+        update(alpha, eve::reduce(wide_t{a + 5 * stride_a} * wb0), beta, c + 5 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 5 * stride_a} * wb1), beta, c + 5 * stride_c + 1);
+        update(alpha, eve::reduce(wide_t{a + 6 * stride_a} * wb0), beta, c + 6 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 6 * stride_a} * wb1), beta, c + 6 * stride_c + 1);
+        update(alpha, eve::reduce(wide_t{a + 7 * stride_a} * wb0), beta, c + 7 * stride_c);
+        update(alpha, eve::reduce(wide_t{a + 7 * stride_a} * wb1), beta, c + 7 * stride_c + 1);
     }
 
     template<typename T>
-    void kernel_884(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
-        kernel_484(a, stride_a, b, stride_b, c, stride_c);
-        kernel_484(a + 4 * stride_a, stride_a, b, stride_b, c + 4 * stride_c, stride_c);
+    void kernel_884(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
+        kernel_484(alpha, a, stride_a, b, stride_b, beta, c, stride_c);
+        kernel_484(alpha, a + 4 * stride_a, stride_a, b, stride_b, beta, c + 4 * stride_c, stride_c);
     }
 
     template<typename T>
-    void kernel_888(const T* a, const int stride_a, const T* b, const int stride_b, T* c, const int stride_c) {
-        kernel_488(a, stride_a, b, stride_b, c, stride_c);
-        kernel_488(a + 4 * stride_a, stride_a, b, stride_b, c + 4 * stride_c, stride_c);
+    void kernel_888(const T alpha, const T* a, const int stride_a, const T* b, const int stride_b, const T beta, T* c, const int stride_c) {
+        kernel_488(alpha, a, stride_a, b, stride_b, beta, c, stride_c);
+        kernel_488(alpha, a + 4 * stride_a, stride_a, b, stride_b, beta, c + 4 * stride_c, stride_c);
     }
 } // namespace gemm::detail
 
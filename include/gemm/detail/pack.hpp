@@ -0,0 +1,172 @@
+#ifndef GEMM_PACK_HPP
+#define GEMM_PACK_HPP
+
+#include <eve/eve.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "blocking.hpp"
+#include "convert.hpp"
+#include "transpose.hpp"
+
+namespace gemm::detail
+{
+    /**
+     * @brief Offset of the element (i, j) of `op(X)`, `X` being a row major matrix with `ld` elements
+     * between two rows, and `op(X)` being either `X` or its transpose.
+     */
+    constexpr int offset(const bool transposed, const int i, const int j, const int ld) {
+        return transposed ? j * ld + i : i * ld + j;
+    }
+
+    /**
+     * @brief Copies `size` contiguous elements, converting them to `T` if they are stored with another type `S` (a
+     * 16-bit floating point type, converted by whole registers, see `convert_elements`).
+     */
+    template<typename T, typename S>
+    void copy_elements(const S* src, const int size, T* dst) {
+        if constexpr (std::is_same_v<S, T>) {
+            std::memcpy(dst, src, size * sizeof(T));
+        } else {
+            convert_elements(src, size, dst);
+        }
+    }
+
+    /**
+     * @brief Copies the `rows x cols` matrix `op(src)` to the row major matrix `dst`, converting its elements to `T`.
+     *
+     * If `transposed` is true, `src` is a `cols x rows` matrix which is transposed by square tiles held in registers
+     * (see `transpose`).
+     */
+    template<typename T, typename S>
+    void pack_block(const bool transposed, const int rows, const int cols, const S* src, const int ld_src, T* dst, const int ld_dst) {
+        if (transposed) {
+            transpose(cols, rows, src, ld_src, dst, ld_dst);
+        } else {
+            for (int i = 0; i < rows; i++) {
+                copy_elements(src + i * ld_src, cols, dst + i * ld_dst);
+            }
+        }
+    }
+
+    /**
+     * @brief Copies the `rows x cols` matrix `op(src)` to `dst` as a sequence of micro-panels of `MR` rows, each one
+     * stored column major (`MR` consecutive elements per column), so that the microkernel reads it in unit stride.
+     * The panel `p` starts at `dst + p * MR * cols`. If `rows` is not a multiple of `MR`, the last panel only holds
+     * the remaining rows (its columns have as many elements), so no padding is stored nor computed. The elements are
+     * converted to `T`.
+     */
+    template<typename T, typename S>
+    void pack_A_panels(const bool transposed, const int rows, const int cols, const S* src, const int ld_src, const int MR, T* dst) {
+        for (int i0 = 0; i0 < rows; i0 += MR) {
+            const int panel_rows = std::min(MR, rows - i0);
+            T* panel = dst + i0 * cols;
+            if (transposed) {
+                // the rows of op(src) are the columns of src: the columns of the panel are contiguous in src
+                for (int k = 0; k < cols; k++) {
+                    copy_elements(src + k * ld_src + i0, panel_rows, panel + k * panel_rows);
+                }
+            } else if constexpr (std::is_same_v<S, T>) {
+                for (int r = 0; r < panel_rows; r++) {
+                    const S* row = src + (i0 + r) * ld_src;
+                    for (int k = 0; k < cols; k++) {
+                        panel[k * panel_rows + r] = row[k];
+                    }
+                }
+            } else {
+                // the rows are converted by whole registers before being spread in the panel
+                constexpr int chunk = 64;
+                std::array<T, chunk> converted;
+                for (int r = 0; r < panel_rows; r++) {
+                    const S* row = src + (i0 + r) * ld_src;
+                    for (int k0 = 0; k0 < cols; k0 += chunk) {
+                        const int size = std::min(chunk, cols - k0);
+                        convert_elements(row + k0, size, converted.data());
+                        for (int k = 0; k < size; k++) {
+                            panel[(k0 + k) * panel_rows + r] = converted[k];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Copies the `rows x cols` matrix `op(src)` to `dst` as a sequence of micro-panels of `NR` columns, each one
+     * stored row major (`NR` consecutive elements per row), so that the microkernel reads it in unit stride.
+     * The panel `q` starts at `dst + q * NR * rows`. If `cols` is not a multiple of `NR`, the missing columns of the
+     * last panel are filled with zeros, the other panels being copied without any extra pass. The elements are converted
+     * to `T`.
+     */
+    template<typename T, typename S>
+    void pack_B_panels(const bool transposed, const int rows, const int cols, const S* src, const int ld_src, const int NR, T* dst) {
+        for (int j0 = 0; j0 < cols; j0 += NR) {
+            const int panel_cols = std::min(NR, cols - j0);
+            T* panel = dst + j0 * rows;
+            if (transposed) {
+                // the columns of op(src) are the rows of src
+                transpose(panel_cols, rows, src + j0 * ld_src, ld_src, panel, NR);
+            } else {
+                for (int k = 0; k < rows; k++) {
+                    copy_elements(src + k * ld_src + j0, panel_cols, panel + k * NR);
+                }
+            }
+
+            // fringe of the last panel
+            if (panel_cols < NR) {
+                for (int k = 0; k < rows; k++) {
+                    std::memset(panel + k * NR + panel_cols, 0, (NR - panel_cols) * sizeof(T));
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Operand of a multiplication as passed by the caller: a row major matrix and the operation
+     * applied to it.
+     */
+    template<typename T>
+    struct operand {
+        const T* data;
+        int ld;
+        bool transposed;
+
+        /**
+         * @brief Address of the element (i, j) of `op(X)`.
+         */
+        const T* at(const int i, const int j) const {
+            return data + offset(transposed, i, j, ld);
+        }
+
+        /**
+         * @brief The operand made of the rows and columns of `op(X)` starting from (i, j).
+         */
+        operand from(const int i, const int j) const {
+            return {at(i, j), ld, transposed};
+        }
+    };
+
+    /**
+     * @brief Packs the `rows x cols` block of `op(A)` starting at its first element in `work_A`, as micro-panels of `MR`
+     * rows.
+     */
+    template<typename T, typename S>
+    void pack_block_A(const operand<S>& A, const int rows, const int cols, const int MR, T* work_A) {
+        pack_A_panels(A.transposed, rows, cols, A.data, A.ld, MR, work_A);
+    }
+
+    /**
+     * @brief Packs the `rows x cols` block of `op(B)` starting at (k, j) in `work_B` (a `BK x BN` array), as micro-panels
+     * of `TILE_WIDTH` columns, the last one being padded with zeros.
+     */
+    template<typename T, typename S>
+    void pack_block_B(const operand<S>& B, const int k, const int j, const int rows, const int cols, T* work_B) {
+        pack_B_panels(B.transposed, rows, cols, B.at(k, j), B.ld, TILE_WIDTH<T>, work_B);
+    }
+} // namespace gemm::detail
+
+#endif
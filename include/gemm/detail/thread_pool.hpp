@@ -0,0 +1,186 @@
+#ifndef GEMM_THREAD_POOL_HPP
+#define GEMM_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace gemm::detail
+{
+    /**
+     * @brief Pool of worker threads used to distribute the blocks of a matrix multiplication.
+     *
+     * The pool runs one job at a time, a job being a number of independent tasks. The calling
+     * thread takes part in the job, so a job using `n` threads wakes up at most `n - 1` workers.
+     */
+    class thread_pool
+    {
+      public:
+        explicit thread_pool(const int nb_workers) {
+            workers.reserve(nb_workers);
+            for (int id = 0; id < nb_workers; id++) {
+                workers.emplace_back([this, id] { worker_loop(id + 1); });
+            }
+        }
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        ~thread_pool() {
+            {
+                std::lock_guard lock(mutex);
+                stop = true;
+            }
+            wake.notify_all();
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+
+        /**
+         * @brief Maximum number of threads which can take part in a job (the workers and the caller).
+         */
+        int size() const {
+            return static_cast<int>(workers.size()) + 1;
+        }
+
+        /**
+         * @brief Calls `f(task, thread_id)` for each task in [0, nb_tasks), using at most `nb_threads` threads.
+         *
+         * `thread_id` is in [0, nb_threads) and is unique among the threads running the job at the same time,
+         * it can be used to index per thread resources. If the pool is already busy (concurrent or nested call),
+         * the tasks are run sequentially by the calling thread.
+         */
+        template<typename F>
+        void run(const int nb_tasks, int nb_threads, F&& f) {
+            nb_threads = std::min({nb_threads, nb_tasks, size()});
+
+            std::unique_lock job_lock(job_mutex, std::defer_lock);
+            if (nb_threads <= 1 || is_worker || !job_lock.try_lock()) {
+                for (int task = 0; task < nb_tasks; task++) {
+                    f(task, 0);
+                }
+                return;
+            }
+
+            {
+                std::lock_guard lock(mutex);
+                job_context = &f;
+                job_invoke = [](void* context, int task, int thread_id) { (*static_cast<std::remove_reference_t<F>*>(context))(task, thread_id); };
+                job_size = nb_tasks;
+                job_threads = nb_threads;
+                next_task = 0;
+                remaining_workers = nb_threads - 1;
+                generation++;
+            }
+            wake.notify_all();
+
+            execute(0);
+
+            std::unique_lock lock(mutex);
+            done.wait(lock, [this] { return remaining_workers == 0; });
+        }
+
+      private:
+        void execute(const int thread_id) {
+            for (int task = next_task++; task < job_size; task = next_task++) {
+                job_invoke(job_context, task, thread_id);
+            }
+        }
+
+        void worker_loop(const int thread_id) {
+            is_worker = true;
+            std::size_t last_generation = 0;
+
+            while (true) {
+                {
+                    std::unique_lock lock(mutex);
+                    wake.wait(lock, [&] { return stop || generation != last_generation; });
+                    if (stop) {
+                        return;
+                    }
+                    last_generation = generation;
+                    if (thread_id >= job_threads) {
+                        continue;
+                    }
+                }
+
+                execute(thread_id);
+
+                std::lock_guard lock(mutex);
+                if (--remaining_workers == 0) {
+                    done.notify_one();
+                }
+            }
+        }
+
+        static inline thread_local bool is_worker = false;
+
+        std::vector<std::thread> workers;
+
+        std::mutex job_mutex; // held by the thread which submitted the current job
+        std::mutex mutex;     // protects the job description below
+        std::condition_variable wake;
+        std::condition_variable done;
+
+        bool stop = false;
+        std::size_t generation = 0;
+        void* job_context = nullptr;
+        void (*job_invoke)(void*, int, int) = nullptr;
+        int job_size = 0;
+        int job_threads = 0;
+        int remaining_workers = 0;
+        std::atomic<int> next_task = 0;
+    };
+
+    /**
+     * @brief Maximum number of threads running a job of the shared pool, one per hardware thread.
+     */
+    inline int max_threads() {
+        static const int nb_threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        return nb_threads;
+    }
+
+    /**
+     * @brief Returns the pool shared by all the calls.
+     */
+    inline thread_pool& get_thread_pool() {
+        static thread_pool pool(max_threads() - 1);
+        return pool;
+    }
+
+    /**
+     * @brief Runs `f(task, thread_id)` for each task in [0, nb_tasks) on the shared pool, or directly on the
+     * calling thread if a single thread is requested.
+     */
+    template<typename F>
+    void parallel_for(const int nb_tasks, const int nb_threads, F&& f) {
+        if (nb_threads <= 1) {
+            for (int task = 0; task < nb_tasks; task++) {
+                f(task, 0);
+            }
+        } else {
+            get_thread_pool().run(nb_tasks, nb_threads, f);
+        }
+    }
+
+    /**
+     * @brief Initial value of the process wide number of threads, read from the `GEMM_NUM_THREADS`
+     * environment variable (1 if it is not set).
+     */
+    inline int default_num_threads() {
+        const char* value = std::getenv("GEMM_NUM_THREADS");
+        const int nb_threads = value != nullptr ? std::atoi(value) : 1;
+        return std::max(nb_threads, 1);
+    }
+
+    inline std::atomic<int> num_threads = default_num_threads();
+} // namespace gemm::detail
+
+#endif
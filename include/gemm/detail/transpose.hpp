@@ -0,0 +1,145 @@
+#ifndef GEMM_TRANSPOSE_HPP
+#define GEMM_TRANSPOSE_HPP
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
+#include "convert.hpp"
+
+namespace gemm::detail
+{
+    /**
+     * @brief Side of the square tiles of `T` elements which `transpose_tile` transposes in registers, or 1 if there is
+     * no register transpose for `T` on the target.
+     *
+     * eve has no portable transpose, so the tiles are transposed with the unpack and shuffle instructions of SSE and
+     * AVX, a tile being as large as the registers (8 floats or 4 doubles with AVX, the 512-bit registers of AVX-512
+     * bringing nothing as the rows of a tile are loaded once).
+     */
+    template<typename T>
+    constexpr int transpose_tile_size = [] {
+#if defined(__AVX__)
+        return std::is_same_v<T, float> ? 8 : std::is_same_v<T, double> ? 4 : 1;
+#elif defined(__SSE2__)
+        return std::is_same_v<T, float> ? 4 : std::is_same_v<T, double> ? 2 : 1;
+#else
+        return 1;
+#endif
+    }();
+
+    /**
+     * @brief Writes the transpose of the `transpose_tile_size<T> x transpose_tile_size<T>` tile `src` to `dst`, the
+     * rows of `src` and `dst` being respectively `ld_src` and `ld_dst` elements apart.
+     *
+     * The rows of `src` are loaded in registers, transposed by shuffles between the registers, and stored as the rows
+     * of `dst`, so both matrices are accessed by whole registers.
+     */
+    template<typename T>
+    void transpose_tile(const T* src, const int ld_src, T* dst, const int ld_dst) {
+        static_assert(transpose_tile_size<T> > 1, "no register transpose for this type");
+#if defined(__AVX__)
+        if constexpr (std::is_same_v<T, float>) {
+            __m256 r[8];
+            for (int i = 0; i < 8; i++) {
+                r[i] = _mm256_loadu_ps(src + i * ld_src);
+            }
+
+            // interleaves the pairs of rows, then the pairs of pairs, then the halves of the registers
+            __m256 t[8];
+            for (int i = 0; i < 8; i += 2) {
+                t[i] = _mm256_unpacklo_ps(r[i], r[i + 1]);
+                t[i + 1] = _mm256_unpackhi_ps(r[i], r[i + 1]);
+            }
+            for (int i = 0; i < 8; i += 4) {
+                r[i] = _mm256_shuffle_ps(t[i], t[i + 2], _MM_SHUFFLE(1, 0, 1, 0));
+                r[i + 1] = _mm256_shuffle_ps(t[i], t[i + 2], _MM_SHUFFLE(3, 2, 3, 2));
+                r[i + 2] = _mm256_shuffle_ps(t[i + 1], t[i + 3], _MM_SHUFFLE(1, 0, 1, 0));
+                r[i + 3] = _mm256_shuffle_ps(t[i + 1], t[i + 3], _MM_SHUFFLE(3, 2, 3, 2));
+            }
+            for (int i = 0; i < 4; i++) {
+                _mm256_storeu_ps(dst + i * ld_dst, _mm256_permute2f128_ps(r[i], r[i + 4], 0x20));
+                _mm256_storeu_ps(dst + (i + 4) * ld_dst, _mm256_permute2f128_ps(r[i], r[i + 4], 0x31));
+            }
+        } else {
+            __m256d r[4];
+            for (int i = 0; i < 4; i++) {
+                r[i] = _mm256_loadu_pd(src + i * ld_src);
+            }
+
+            const __m256d t0 = _mm256_unpacklo_pd(r[0], r[1]);
+            const __m256d t1 = _mm256_unpackhi_pd(r[0], r[1]);
+            const __m256d t2 = _mm256_unpacklo_pd(r[2], r[3]);
+            const __m256d t3 = _mm256_unpackhi_pd(r[2], r[3]);
+            _mm256_storeu_pd(dst, _mm256_permute2f128_pd(t0, t2, 0x20));
+            _mm256_storeu_pd(dst + ld_dst, _mm256_permute2f128_pd(t1, t3, 0x20));
+            _mm256_storeu_pd(dst + 2 * ld_dst, _mm256_permute2f128_pd(t0, t2, 0x31));
+            _mm256_storeu_pd(dst + 3 * ld_dst, _mm256_permute2f128_pd(t1, t3, 0x31));
+        }
+#elif defined(__SSE2__)
+        if constexpr (std::is_same_v<T, float>) {
+            __m128 r0 = _mm_loadu_ps(src);
+            __m128 r1 = _mm_loadu_ps(src + ld_src);
+            __m128 r2 = _mm_loadu_ps(src + 2 * ld_src);
+            __m128 r3 = _mm_loadu_ps(src + 3 * ld_src);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            _mm_storeu_ps(dst, r0);
+            _mm_storeu_ps(dst + ld_dst, r1);
+            _mm_storeu_ps(dst + 2 * ld_dst, r2);
+            _mm_storeu_ps(dst + 3 * ld_dst, r3);
+        } else {
+            const __m128d r0 = _mm_loadu_pd(src);
+            const __m128d r1 = _mm_loadu_pd(src + ld_src);
+            _mm_storeu_pd(dst, _mm_unpacklo_pd(r0, r1));
+            _mm_storeu_pd(dst + ld_dst, _mm_unpackhi_pd(r0, r1));
+        }
+#endif
+    }
+
+    /**
+     * @brief Writes the transpose of the `rows x cols` matrix `src` to the `cols x rows` matrix `dst`, converting its
+     * elements to `T` if they are stored with another type `S` (a 16-bit floating point type).
+     *
+     * The matrices are split in square tiles, transposed in registers by `transpose_tile` (the rows of a tile being
+     * first converted to `T` by `convert_elements` if `S` is another type), and element by element at the fringes or
+     * if there is no register transpose for `T`, so that the rows of a tile read in `src` and the ones written in
+     * `dst` stay in the L1 cache.
+     */
+    template<typename T, typename S>
+    void transpose(const int rows, const int cols, const S* src, const int ld_src, T* dst, const int ld_dst) {
+        constexpr bool in_registers = transpose_tile_size<T> > 1;
+        constexpr int tile = in_registers ? transpose_tile_size<T> : 16;
+
+        for (int i0 = 0; i0 < rows; i0 += tile) {
+            const int i_end = std::min(i0 + tile, rows);
+            for (int j0 = 0; j0 < cols; j0 += tile) {
+                const int j_end = std::min(j0 + tile, cols);
+                if constexpr (in_registers) {
+                    if (i_end - i0 == tile && j_end - j0 == tile) {
+                        if constexpr (std::is_same_v<S, T>) {
+                            transpose_tile(src + i0 * ld_src + j0, ld_src, dst + j0 * ld_dst + i0, ld_dst);
+                        } else {
+                            std::array<T, tile * tile> converted;
+                            for (int i = 0; i < tile; i++) {
+                                convert_elements(src + (i0 + i) * ld_src + j0, tile, converted.data() + i * tile);
+                            }
+                            transpose_tile(converted.data(), tile, dst + j0 * ld_dst + i0, ld_dst);
+                        }
+                        continue;
+                    }
+                }
+                for (int i = i0; i < i_end; i++) {
+                    for (int j = j0; j < j_end; j++) {
+                        dst[j * ld_dst + i] = static_cast<T>(src[i * ld_src + j]);
+                    }
+                }
+            }
+        }
+    }
+} // namespace gemm::detail
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef GEMM_UPDATE_HPP
+#define GEMM_UPDATE_HPP
+
+#include <eve/eve.hpp>
+
+#include <type_traits>
+
+namespace gemm::detail
+{
+    /**
+     * @brief Stores `alpha * ab + beta * c` to `c`, `ab` being either a single value or a register of consecutive
+     * values. `c` is not read if `beta` is 0.
+     */
+    template<typename T, typename V>
+    void update(const T alpha, const V ab, const T beta, T* c) {
+        if constexpr (std::is_same_v<V, T>) {
+            *c = beta == 0 ? alpha * ab : alpha * ab + beta * *c;
+        } else {
+            eve::store(beta == 0 ? alpha * ab : eve::fma(alpha, ab, beta * V{c}), c);
+        }
+    }
+} // namespace gemm::detail
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef GEMM_DISPATCH_HPP
+#define GEMM_DISPATCH_HPP
+
+#include "gemm/types.hpp"
+
+#if defined(_WIN32)
+#define GEMM_DISPATCH_API
+#else
+#define GEMM_DISPATCH_API __attribute__((visibility("default")))
+#endif
+
+/**
+ * Interface of the `gemm_dispatch` library (built with the `GEMM_BUILD_DISPATCH` CMake option).
+ *
+ * The header only library is compiled for the instruction set of the build machine. The dispatch library
+ * contains a build of the multiplication for each of the instruction sets below, and chooses the best one
+ * supported by the host when it is loaded, so that a single binary can run on different machines.
+ */
+namespace gemm::dispatch
+{
+    /**
+     * @brief Instruction sets for which the dispatch library is built, from the least to the most capable.
+     */
+    enum class isa {
+        sse4_2,
+        avx2,
+        avx512
+    };
+
+    /**
+     * @brief Returns the instruction set used by the multiplications: the most capable one supported by the host,
+     * capped by the `GEMM_ISA` environment variable (`sse4_2`, `avx2` or `avx512`) if it is set.
+     */
+    GEMM_DISPATCH_API isa selected_isa();
+
+    /**
+     * @brief Returns the name of an instruction set, as accepted by `GEMM_ISA`.
+     */
+    GEMM_DISPATCH_API const char* isa_name(isa instruction_set);
+
+    /**
+     * @brief Sets the number of threads used by default by the multiplications of the dispatch library.
+     *
+     * The initial value is read from the `GEMM_NUM_THREADS` environment variable, and defaults to 1.
+     */
+    GEMM_DISPATCH_API void set_num_threads(int nb_threads);
+
+    /**
+     * @brief Returns the number of threads used by default by the multiplications of the dispatch library.
+     */
+    GEMM_DISPATCH_API int get_num_threads();
+
+    /**
+     * @brief Performs the operation `C = alpha * op(A)op(B)  + beta * C` in simple precision, using at most
+     * `nb_threads` threads. The parameters are the ones of `gemm::gemm`.
+     */
+    GEMM_DISPATCH_API void sgemm(transposition transA, transposition transB, int M, int N, int K, float alpha, const float* A, int lda, const float* B,
+      int ldb, float beta, float* C, int ldc, int nb_threads);
+
+    /**
+     * @brief Performs the operation `C = alpha * op(A)op(B)  + beta * C` in simple precision, using the default
+     * number of threads of the dispatch library.
+     */
+    GEMM_DISPATCH_API void sgemm(transposition transA, transposition transB, int M, int N, int K, float alpha, const float* A, int lda, const float* B,
+      int ldb, float beta, float* C, int ldc);
+
+    /**
+     * @brief Performs the operation `C = alpha * op(A)op(B)  + beta * C` in double precision, using at most
+     * `nb_threads` threads. The parameters are the ones of `gemm::gemm`.
+     */
+    GEMM_DISPATCH_API void dgemm(transposition transA, transposition transB, int M, int N, int K, double alpha, const double* A, int lda,
+      const double* B, int ldb, double beta, double* C, int ldc, int nb_threads);
+
+    /**
+     * @brief Performs the operation `C = alpha * op(A)op(B)  + beta * C` in double precision, using the default
+     * number of threads of the dispatch library.
+     */
+    GEMM_DISPATCH_API void dgemm(transposition transA, transposition transB, int M, int N, int K, double alpha, const double* A, int lda,
+      const double* B, int ldb, double beta, double* C, int ldc);
+} // namespace gemm::dispatch
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef GEMM_EPILOGUE_HPP
+#define GEMM_EPILOGUE_HPP
+
+#include <eve/eve.hpp>
+#include <eve/module/core.hpp>
+#include <eve/module/special.hpp>
+
+namespace gemm
+{
+    /**
+     * @brief Activation function applied by an `epilogue` to the elements of `C`.
+     */
+    enum class activation {
+        none,
+        relu, // max(x, 0)
+        gelu  // x * Phi(x), Phi being the cumulative distribution function of the standard normal distribution
+    };
+
+    /**
+     * @brief Element-wise operations applied to `C` by the multiplication once `alpha * op(A)op(B) + beta * C` is
+     * computed, while `C` is still in cache:
+     * `C[i][j] = act(C[i][j] * row_scale[i] * col_scale[j] + row_bias[i] + col_bias[j])`.
+     *
+     * The vectors which are null are not applied. An empty epilogue (the default) leaves `C` unchanged and costs
+     * nothing.
+     */
+    template<typename T>
+    struct epilogue {
+        const T* row_scale = nullptr; // one factor per row of C
+        const T* col_scale = nullptr; // one factor per column of C
+        const T* row_bias = nullptr;  // one value per row of C
+        const T* col_bias = nullptr;  // one value per column of C
+        activation act = activation::none;
+
+        /**
+         * @brief Tells if the epilogue modifies `C`.
+         */
+        bool active() const {
+            return row_scale != nullptr || col_scale != nullptr || row_bias != nullptr || col_bias != nullptr || act != activation::none;
+        }
+
+        /**
+         * @brief The epilogue of the rows and columns of `C` starting from (i, j).
+         */
+        epilogue from(const int i, const int j) const {
+            const auto shift = [](const T* v, const int offset) { return v != nullptr ? v + offset : nullptr; };
+            return {shift(row_scale, i), shift(col_scale, j), shift(row_bias, i), shift(col_bias, j), act};
+        }
+
+        /**
+         * @brief Applies the epilogue to the `rows x cols` block of `C` starting at `C` (the element (0, 0) of the
+         * epilogue), a register of consecutive elements of a row at a time.
+         */
+        void apply(const int rows, const int cols, T* C, const int ldc) const {
+            using wide_t = eve::wide<T>;
+            constexpr int size = wide_t::size();
+
+            const int full_cols = cols - cols % size;
+            for (int i = 0; i < rows; i++) {
+                T* c = C + i * ldc;
+                for (int j = 0; j < full_cols; j += size) {
+                    const auto load = [=](const T* v) { return wide_t{v + j}; };
+                    eve::store(element(wide_t{c + j}, i, load), c + j);
+                }
+                for (int j = full_cols; j < cols; j++) {
+                    c[j] = element(c[j], i, [=](const T* v) { return v[j]; });
+                }
+            }
+        }
+
+      private:
+        /**
+         * @brief Applies the epilogue to `x`, an element or a register of elements of the row `i`, `load(v)` returning
+         * the elements of the column vector `v` matching `x`.
+         */
+        template<typename V, typename Load>
+        V element(V x, const int i, const Load& load) const {
+            if (row_scale != nullptr) {
+                x = x * row_scale[i];
+            }
+            if (col_scale != nullptr) {
+                x = x * load(col_scale);
+            }
+            if (row_bias != nullptr) {
+                x = x + row_bias[i];
+            }
+            if (col_bias != nullptr) {
+                x = x + load(col_bias);
+            }
+
+            switch (act) {
+            case activation::relu:
+                return eve::max(x, V{T{0}});
+            case activation::gelu:
+                return T{0.5} * x * (T{1} + eve::erf(x * static_cast<T>(0.70710678118654752440)));
+            default:
+                return x;
+            }
+        }
+    };
+} // namespace gemm
+
+#endif
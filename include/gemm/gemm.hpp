@@ -5,33 +5,42 @@
 #include <eve/module/algo.hpp>
 #include <eve/module/core.hpp>
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstring>
 #include <span>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "gemm/detail/blocking.hpp"
+#include "gemm/detail/gemv.hpp"
 #include "gemm/detail/kernels.hpp"
+#include "gemm/detail/pack.hpp"
+#include "gemm/detail/thread_pool.hpp"
+#include "gemm/epilogue.hpp"
+#include "gemm/packed_matrix.hpp"
+#include "gemm/tuning.hpp"
+#include "gemm/types.hpp"
+#include "gemm/workspace.hpp"
 
 namespace gemm
 {
-    enum class transposition {
-        none,
-        transpose,
-        conjugate_transpose
-    };
-
     namespace detail
     {
         /**
-         * @brief Multiplies two matrices by combining multiple kernels
+         * @brief Computes `c = alpha * ab + beta * c` by combining multiple kernels
          */
         template<typename T>
-        constexpr void compose_kernel(const int M, const int N, const int K, const T* a, int lda, const T* b, int ldb, T* c, int ldc) {
+        constexpr void compose_kernel(
+          const int M, const int N, const int K, const T alpha, const T* a, int lda, const T* b, int ldb, const T beta, T* c, int ldc) {
             const bool has_kernel_M = M <= kernel_max_dim;
             const bool has_kernel_N = N <= kernel_max_dim;
             const bool has_kernel_K = K <= kernel_max_dim;
 
             if (has_kernel_M && has_kernel_N && has_kernel_K) {
-                get_kernel<T>(M, N, K)(a, lda, b, ldb, c, ldc);
+                get_kernel<T>(M, N, K)(alpha, a, lda, b, ldb, beta, c, ldc);
             } else {
                 const auto split_dim = std::max({
                     M * !has_kernel_M,
@@ -40,192 +49,836 @@ namespace gemm
                 });
 
                 if (split_dim == M) {
-                    compose_kernel<T>(kernel_max_dim, N, K, a, lda, b, ldb, c, ldc);
-                    compose_kernel<T>(M - kernel_max_dim, N, K, a + kernel_max_dim * lda, lda, b, ldb, c + kernel_max_dim * ldc, ldc);
+                    compose_kernel<T>(kernel_max_dim, N, K, alpha, a, lda, b, ldb, beta, c, ldc);
+                    compose_kernel<T>(M - kernel_max_dim, N, K, alpha, a + kernel_max_dim * lda, lda, b, ldb, beta, c + kernel_max_dim * ldc, ldc);
                 } else if (split_dim == N) {
-                    compose_kernel<T>(M, kernel_max_dim, K, a, lda, b, ldb, c, ldc);
-                    compose_kernel<T>(M, N - kernel_max_dim, K, a, lda, b + kernel_max_dim, ldb, c + kernel_max_dim, ldc);
+                    compose_kernel<T>(M, kernel_max_dim, K, alpha, a, lda, b, ldb, beta, c, ldc);
+                    compose_kernel<T>(M, N - kernel_max_dim, K, alpha, a, lda, b + kernel_max_dim, ldb, beta, c + kernel_max_dim, ldc);
                 } else { // split_dim == K
-                    compose_kernel<T>(M, N, kernel_max_dim, a, lda, b, ldb, c, ldc);
-                    compose_kernel<T>(M, N, K - kernel_max_dim, a + kernel_max_dim, lda, b + kernel_max_dim * ldb, ldb, c, ldc);
+                    compose_kernel<T>(M, N, kernel_max_dim, alpha, a, lda, b, ldb, beta, c, ldc);
+                    compose_kernel<T>(M, N, K - kernel_max_dim, alpha, a + kernel_max_dim, lda, b + kernel_max_dim * ldb, ldb, T{1}, c, ldc);
                 }
             }
         }
 
         /**
-         * @brief Matrix multiplication of small matrices
+         * @brief A call of a kernel of the small multiplications, the operands being given by their offsets from the
+         * first element of `A`, `B` and `C`. The call adds its product to `C` (`beta` is 1) if it is not the first
+         * one of its part of `C` along K.
          */
         template<typename T>
-        void gemm_small(
-          const int M, const int N, const int K, const T alpha, const T* A, const int lda, const T* B, const int ldb, const T beta, T* C, const int ldc) {
-            std::vector<T> ab(M * N);
-            const int ldab = N;
+        struct kernel_call {
+            kernel<T> function;
+            int offset_a;
+            int offset_b;
+            int offset_c;
+            bool accumulate;
+        };
 
-            compose_kernel(M, N, K, A, lda, B, ldb, ab.data(), ldab);
+        /**
+         * @brief Appends to `calls` the kernel calls made by `compose_kernel` for the given dimensions, in the same
+         * order, so that they can be replayed without its recursion.
+         */
+        template<typename T>
+        void plan_kernels(const int M, const int N, const int K, const int lda, const int ldb, const int ldc, const int offset_a, const int offset_b,
+          const int offset_c, const bool accumulate, std::vector<kernel_call<T>>& calls) {
+            const bool has_kernel_M = M <= kernel_max_dim;
+            const bool has_kernel_N = N <= kernel_max_dim;
+            const bool has_kernel_K = K <= kernel_max_dim;
 
-            for (int i = 0; i < M; i++) {
-                for (int j = 0; j < N; j++) {
-                    C[i * ldc + j] = alpha * ab[i * ldab + j] + beta * C[i * ldc + j];
-                }
+            if (has_kernel_M && has_kernel_N && has_kernel_K) {
+                calls.push_back({get_kernel<T>(M, N, K), offset_a, offset_b, offset_c, accumulate});
+                return;
+            }
+
+            const auto split_dim = std::max({M * !has_kernel_M, N * !has_kernel_N, K * !has_kernel_K});
+            constexpr int d = kernel_max_dim;
+            if (split_dim == M) {
+                plan_kernels(d, N, K, lda, ldb, ldc, offset_a, offset_b, offset_c, accumulate, calls);
+                plan_kernels(M - d, N, K, lda, ldb, ldc, offset_a + d * lda, offset_b, offset_c + d * ldc, accumulate, calls);
+            } else if (split_dim == N) {
+                plan_kernels(M, d, K, lda, ldb, ldc, offset_a, offset_b, offset_c, accumulate, calls);
+                plan_kernels(M, N - d, K, lda, ldb, ldc, offset_a, offset_b + d, offset_c + d, accumulate, calls);
+            } else { // split_dim == K
+                plan_kernels(M, N, d, lda, ldb, ldc, offset_a, offset_b, offset_c, accumulate, calls);
+                plan_kernels(M, N, K - d, lda, ldb, ldc, offset_a + d, offset_b + d * ldb, offset_c, true, calls);
             }
         }
 
-        // size constants
+        /**
+         * @brief Replays the kernel calls `calls` planned by `plan_kernels` for the leading dimensions `lda`, `ldb` and
+         * `ldc`, computing `C = alpha * AB + beta * C` as `compose_kernel` does.
+         */
         template<typename T>
-        constexpr int BM = 250; // rows of A
+        void run_kernels(std::span<const kernel_call<T>> calls, const T alpha, const T* A, const int lda, const T* B, const int ldb, const T beta, T* C,
+          const int ldc) {
+            for (const auto& call : calls) {
+                call.function(alpha, A + call.offset_a, lda, B + call.offset_b, ldb, call.accumulate ? T{1} : beta, C + call.offset_c, ldc);
+            }
+        }
 
-        template<typename T>
-        constexpr int BN = 64; // columns of B
+        /**
+         * @brief Maximum dimension of the matrices handled by `gemm_small`
+         */
+        constexpr int small_max_dim = 63;
+
+        /**
+         * @brief Tells if a multiplication is handled by `gemm_small`.
+         */
+        constexpr bool is_small(const int M, const int N, const int K) {
+            return M <= small_max_dim && N <= small_max_dim && K <= small_max_dim;
+        }
+
+        /**
+         * @brief Number of elements of the workspace used by `gemm_small`: the copies of the transposed operands.
+         */
+        constexpr std::size_t small_workspace_size(const int M, const int N, const int K) {
+            return static_cast<std::size_t>(M) * K + static_cast<std::size_t>(K) * N;
+        }
 
+        /**
+         * @brief Computes `C = beta * C`, the result of an empty product (`K` is 0). `C` is not read if `beta` is 0.
+         */
         template<typename T>
-        constexpr int BK = 70; // columns of A/rows of B
+        void scale_matrix(const int M, const int N, const T beta, T* C, const int ldc) {
+            for (int i = 0; i < M; i++) {
+                auto c = std::span(C + i * ldc, N);
+                if (beta == 0) {
+                    std::fill(c.begin(), c.end(), T{0});
+                } else {
+                    eve::algo::transform_to(c, c, [beta](auto x) { return beta * x; });
+                }
+            }
+        }
+
+        /**
+         * @brief Matrix multiplication of small matrices
+         *
+         * The kernels apply `alpha` and `beta` when storing `C`, so `C` is accessed once and no intermediate product
+         * is stored. They only read row major operands of type `T`, so a transposed operand, or an operand stored
+         * with a 16-bit type `S`, is first copied to the workspace `work`, of size `small_workspace_size(M, N, K)`.
+         * The epilogue `post` is applied to `C` right after it, while `C` is still in the L1 cache.
+         */
+        template<typename T, typename S>
+        void gemm_small(const bool transA, const bool transB, const int M, const int N, const int K, const T alpha, const S* A, const int lda, const S* B,
+          const int ldb, const T beta, T* C, const int ldc, T* work, const epilogue<T>& post = {}) {
+            // the kernels need non empty matrices
+            if (M == 0 || N == 0) {
+                return;
+            }
+            if (K == 0) {
+                scale_matrix(M, N, beta, C, ldc);
+            } else if constexpr (!std::is_same_v<S, T>) {
+                T* work_A = work;
+                T* work_B = work_A + M * K;
+                pack_block(transA, M, K, A, lda, work_A, K);
+                pack_block(transB, K, N, B, ldb, work_B, N);
+                compose_kernel(M, N, K, alpha, work_A, K, work_B, N, beta, C, ldc);
+            } else if (transA || transB) {
+                T* work_A = work;
+                T* work_B = work_A + M * K;
+                if (transA) {
+                    pack_block(true, M, K, A, lda, work_A, K);
+                }
+                if (transB) {
+                    pack_block(true, K, N, B, ldb, work_B, N);
+                }
+                compose_kernel(M, N, K, alpha, transA ? work_A : A, transA ? K : lda, transB ? work_B : B, transB ? N : ldb, beta, C, ldc);
+            } else {
+                compose_kernel(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+            }
+
+            if (post.active()) {
+                post.apply(M, N, C, ldc);
+            }
+        }
+
+        /**
+         * @brief A tile of C held in registers: `MR` rows of `NW` registers.
+         */
+        template<typename T, int MR, int NW>
+        using tile = std::array<std::array<eve::wide<T>, NW>, MR>;
+
+        /**
+         * @brief Computes the product of a micro-panel of `A` (`MR` rows stored column major) and the first `NW` registers
+         * of a micro-panel of `B` (`TILE_WIDTH` columns stored row major) over `K` columns/rows.
+         *
+         * Both micro-panels are read in unit stride, and the tile stays in registers for the whole K block.
+         */
+        template<typename T, int MR, int NW>
+        void microkernel(const int K, const T* a, const T* b, tile<T, MR, NW>& ab) {
+            using wide_t = eve::wide<T>;
+            constexpr int NR = TILE_WIDTH<T>;
+
+            for (auto& row : ab) {
+                row.fill(wide_t{T{0}});
+            }
+
+            for (int k = 0; k < K; k++) {
+                std::array<wide_t, NW> wb;
+                for (int w = 0; w < NW; w++) {
+                    wb[w] = wide_t{b + k * NR + w * wide_t::size()};
+                }
+                for (int r = 0; r < MR; r++) {
+                    const wide_t wa{a[k * MR + r]};
+                    for (int w = 0; w < NW; w++) {
+                        ab[r][w] = eve::fma(wa, wb[w], ab[r][w]);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Writes the `cols` first columns of a tile of products `AB` (computed for one K block) to `C`.
+         *
+         * For the first K block, `C = alpha * AB + beta * C` (`C` is not read if `beta` is 0), for the following
+         * ones `C = alpha * AB + C`. The register holding the last columns is loaded and stored with a mask if the
+         * tile is narrower than `NW` registers.
+         */
+        template<typename T, int MR, int NW>
+        void store_tile(const tile<T, MR, NW>& c_tile, const int cols, const T alpha, const T beta, const bool first_K, T* C, const int ldc) {
+            using wide_t = eve::wide<T>;
+
+            const auto update = [=](const wide_t ab, const auto& load_c) -> wide_t {
+                if (!first_K) {
+                    return eve::fma(alpha, ab, load_c());
+                } else if (beta == 0) {
+                    return alpha * ab;
+                } else {
+                    return eve::fma(alpha, ab, beta * load_c());
+                }
+            };
+
+            for (int w = 0; w < NW; w++) {
+                const int wide_cols = std::min<int>(cols - w * wide_t::size(), wide_t::size());
+
+                if (wide_cols == wide_t::size()) {
+                    for (int tile_i = 0; tile_i < MR; tile_i++) {
+                        T* c = C + tile_i * ldc + w * wide_t::size();
+                        eve::store(update(c_tile[tile_i][w], [=] { return wide_t{c}; }), c);
+                    }
+                } else {
+                    const auto keep = eve::ignore_last(wide_t::size() - wide_cols);
+                    for (int tile_i = 0; tile_i < MR; tile_i++) {
+                        T* c = C + tile_i * ldc + w * wide_t::size();
+                        eve::store[keep](update(c_tile[tile_i][w], [=] { return eve::load[keep](c); }), c);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Computes a tile of `MR` rows and `cols` columns (at most `NW` registers) of `C` for one K block, from
+         * the micro-panels `a` and `b`.
+         */
+        template<typename T, int MR, int NW>
+        void compute_tile(const int K, const T* a, const T* b, const int cols, const T alpha, const T beta, const bool first_K, T* C, const int ldc) {
+            tile<T, MR, NW> c_tile;
+            microkernel<T, MR, NW>(K, a, b, c_tile);
+            store_tile<T, MR, NW>(c_tile, cols, alpha, beta, first_K, C, ldc);
+        }
 
         template<typename T>
-        constexpr int TILE_HEIGHT = 10;
+        using tile_function = void (*)(int, const T*, const T*, int, T, T, bool, T*, int);
+
+        template<typename T, int MR>
+        constexpr auto fringe_tiles_row = []<int... W>(std::integer_sequence<int, W...>) {
+            return std::array<tile_function<T>, sizeof...(W)>{&compute_tile<T, MR, W + 1>...};
+        }(std::make_integer_sequence<int, TILE_WIDES<T>>{});
+
+        /**
+         * @brief Tiles at the fringes of the blocks: `fringe_tiles<T, MR>[rows - 1][wides - 1]` computes a tile of
+         * `rows` rows (at most `MR`) and `wides` registers, so that no padding row or register is computed.
+         */
+        template<typename T, int MR>
+        constexpr auto fringe_tiles = []<int... R>(std::integer_sequence<int, R...>) {
+            return std::array{fringe_tiles_row<T, R + 1>...};
+        }(std::make_integer_sequence<int, MR>{});
+
+        /**
+         * @brief Multiplies a block of `M` rows and `K` columns of `op(A)` (at most `BM x BK`) by the packed blocks of
+         * `B` of the same K block covering `N` columns, `block_B(j)` returning the block starting at the column `j`.
+         *
+         * The products of the K block are accumulated in registers by the microkernel and added to `C` when the tile
+         * is stored, so `C` is read and written once per K block and no intermediate matrix is needed: for the first
+         * K block (`first_K`), `C = alpha * AB + beta * C`, for the following ones `C = alpha * AB + C`. For the last K
+         * block, the epilogue `post` (if not null, its element (0, 0) being the one of `C`) is applied to each tile right
+         * after it is stored.
+         *
+         * The block of `A` is packed in `work_A` as micro-panels of `TILE_HEIGHT` rows (see `pack_block_A`), the
+         * transposition being applied while packing. The block sizes are given by `sizes`, and the tile height (`MR`)
+         * by `TILE_HEIGHT`.
+         */
+        template<typename T, int TILE_HEIGHT, typename MatrixA, typename BlockB>
+        void gemm_block(const int M, const int N, const int K, const T alpha, const MatrixA& A, const BlockB& block_B, const T beta, const bool first_K,
+          T* C, const int ldc, const blocking& sizes, T* work_A, const epilogue<T>* post = nullptr) {
+            const int BN = sizes.BN;
+            constexpr auto TILE_WIDES = gemm::detail::TILE_WIDES<T>;
+            constexpr auto TILE_WIDTH = gemm::detail::TILE_WIDTH<T>;
+            constexpr int wide_size = eve::wide<T>::size();
+
+            // Fill work_A
+            pack_block_A(A, M, K, TILE_HEIGHT, work_A);
+
+            for (int bj = 0; bj < N; bj += BN) {
+                // "real" number of columns of the current block
+                const int real_N = std::min(N - bj, BN);
+                const T* packed_B = block_B(bj);
+
+                // Block
+                for (int ti = 0; ti < M; ti += TILE_HEIGHT) {
+                    const int rows = std::min(M - ti, TILE_HEIGHT);
+                    const T* panel_A = work_A + ti * K;
+                    for (int tj = 0; tj < real_N; tj += TILE_WIDTH) {
+                        const int cols = std::min(real_N - tj, TILE_WIDTH);
+                        T* c = C + ti * ldc + (bj + tj);
+
+                        // Kernel: C <- A*B, the fringes using smaller tiles
+                        if (rows == TILE_HEIGHT && cols == TILE_WIDTH) {
+                            compute_tile<T, TILE_HEIGHT, TILE_WIDES>(K, panel_A, packed_B + tj * K, cols, alpha, beta, first_K, c, ldc);
+                        } else {
+                            const int wides = (cols + wide_size - 1) / wide_size;
+                            fringe_tiles<T, TILE_HEIGHT>[rows - 1][wides - 1](K, panel_A, packed_B + tj * K, cols, alpha, beta, first_K, c, ldc);
+                        }
+                        if (post != nullptr) {
+                            post->from(ti, bj + tj).apply(rows, cols, c, ldc);
+                        }
+                    }
+                }
+                // End of block
+            }
+        }
 
+        /**
+         * @brief Number of elements of the workspace used by `gemm` with `nb_threads` threads: one `BM x BK` block of
+         * `A` per thread, followed by the `BK x NC` panel of `B` shared by the threads unless `B` is already packed.
+         */
         template<typename T>
-        constexpr int TILE_WIDTH = eve::wide<T>::size();
+        std::size_t blocked_workspace_size(const blocking& sizes, const int N, const int nb_threads, const bool packed_B = false) {
+            const std::size_t panel_size = packed_B ? 0 : static_cast<std::size_t>(sizes.BK) * panel_width<T>(sizes, N);
+            return nb_threads * block_workspace_size(sizes) + panel_size;
+        }
 
         /**
          * @brief Matrix multiplication of matrices of any dimensions
+         *
+         * The loops follow the GotoBLAS order: the columns of `op(B)` are split in panels of `NC` columns (see
+         * `panel_width`), and each `BK x NC` panel of a K block is packed once, the threads sharing its blocks, then
+         * multiplied by all the blocks of `BM` rows of `A`. `B` is either an `operand` or a `packed_matrix`, whose
+         * blocks are used directly.
+         *
+         * The multiplication of a panel is split in blocks of `BM` rows of `C`, and in chunks of whole `BN` blocks of
+         * columns when there are not enough row blocks to keep `nb_threads` threads busy. Each (row block, column
+         * chunk) is an independent task. `sizes` must be valid (see `is_valid`), and `work` holds
+         * `blocked_workspace_size<T>(sizes, N, nb_threads)` elements. `A` is any matrix with a `pack_block_A`
+         * overload, an `operand` in general. The epilogue `post` is applied to the tiles of the last K block as they are
+         * stored.
          */
-        template<typename T>
-        void gemm(
-          const int M, const int N, const int K, const T alpha, const T* A, const int lda, const T* B, const int ldb, const T beta, T* C, const int ldc) {
-            using wide_t = eve::wide<T>;
+        template<typename T, typename MatrixA, typename MatrixB>
+        void gemm(const int M, const int N, const int K, const T alpha, const MatrixA& A, const MatrixB& B, const T beta, T* C, const int ldc,
+          const blocking& sizes, const int nb_threads, T* work, const epilogue<T>& post = {}) {
+            constexpr bool packed_B = std::is_same_v<MatrixB, packed_matrix<T>>;
+            const int BM = sizes.BM;
+            const int BN = sizes.BN;
+            const int BK = sizes.BK;
+
+            if (K == 0) {
+                scale_matrix(M, N, beta, C, ldc);
+                if (post.active()) {
+                    post.apply(M, N, C, ldc);
+                }
+                return;
+            }
 
-            constexpr auto BM = gemm::detail::BM<T>;
-            constexpr auto BN = gemm::detail::BN<T>;
-            constexpr auto BK = gemm::detail::BK<T>;
-            constexpr auto TILE_HEIGHT = gemm::detail::TILE_HEIGHT<T>;
-            constexpr auto TILE_WIDTH = gemm::detail::TILE_WIDTH<T>;
+            const int NC = panel_width<T>(sizes, N);
+            const std::size_t block_B_size = static_cast<std::size_t>(BK) * BN;
+            T* panel_B = work + nb_threads * block_workspace_size(sizes);
 
-            static_assert(BM % TILE_HEIGHT == 0, "BM should be a multiple of TILE_HEIGHT");
-            static_assert(BN % TILE_WIDTH == 0, "BN should be a multiple of TILE_WIDTH");
-            static_assert(BK % TILE_HEIGHT == 0, "BK should be a multiple of TILE_HEIGHT");
-
-            // round M and N to the nearest multiple of TILE_HEIGHT AND TILE_WIDTH RESPECTIVELY
-            const int padded_M = ((M + TILE_HEIGHT - 1) / TILE_HEIGHT) * TILE_HEIGHT;
-            const int padded_N = ((N + TILE_WIDTH - 1) / TILE_WIDTH) * TILE_WIDTH;
-
-            // work arrays
-            std::vector<T> ab(padded_M * padded_N);
-            T* AB = ab.data();
-            const int ldab = padded_N;
-
-            std::array<T, BM * BK> work_A;
-            constexpr int ldwa = BK;
-            std::array<T, BK * BN> work_B;
-            constexpr int ldwb = BN;
-
-            std::array<wide_t, TILE_HEIGHT> c_tile;
-
-            // "real" dimensions of the current block
-            int real_M;
-            int real_N;
-            int real_K;
-
-            for (int i = 0; i < M; i += BM) {
-                real_M = std::min(M - i, BM);
-                for (int k = 0; k < K; k += BK) {
-                    real_K = std::min(K - k, BK);
-                    // Fill work_A
-                    std::memset(work_A.data(), 0, work_A.size() * sizeof(T));
-                    for (int row = 0; row < real_M; row++) {
-                        std::memcpy(work_A.data() + row * ldwa, A + (i + row) * lda + k, real_K * sizeof(T));
-                    }
+            const int blocks_M = (M + BM - 1) / BM;
+            const int wanted_tasks = nb_threads > 1 ? 2 * nb_threads : 1;
+
+            with_tile_height(sizes.tile_height, [&](auto tile_height) {
+                for (int jc = 0; jc < N; jc += NC) {
+                    const int panel_N = std::min(N - jc, NC);
+
+                    // task decomposition
+                    const int blocks_N = (panel_N + BN - 1) / BN;
+                    const int chunks_N = std::min(blocks_N, (wanted_tasks + blocks_M - 1) / blocks_M);
+                    const int chunk_width = ((blocks_N + chunks_N - 1) / chunks_N) * BN;
 
-                    for (int j = 0; j < N; j += BN) {
-                        real_N = std::min(N - j, BN);
-                        // Fill work_B
-                        std::memset(work_B.data(), 0, work_B.size() * sizeof(T));
-                        for (int row = 0; row < real_K; row++) {
-                            std::memcpy(work_B.data() + row * ldwb, B + (k + row) * ldb + j, real_N * sizeof(T));
+                    for (int k = 0; k < K; k += BK) {
+                        const int real_K = std::min(K - k, BK);
+                        const bool last_K = k + real_K == K && post.active();
+
+                        // Pack the panel of B once for all the row blocks
+                        if constexpr (!packed_B) {
+                            parallel_for(blocks_N, nb_threads, [=, &B](const int bj, int) {
+                                const int j = bj * BN;
+                                pack_block_B(B, k, jc + j, real_K, std::min(panel_N - j, BN), panel_B + bj * block_B_size);
+                            });
                         }
 
-                        // Block
-                        for (int bi = 0; bi < real_M; bi += TILE_HEIGHT) {
-                            for (int bj = 0; bj < real_N; bj += TILE_WIDTH) {
-                                // Kernel
-                                // Load tile of C
-                                for (int tile_i = 0; tile_i < TILE_HEIGHT; tile_i++) {
-                                    c_tile[tile_i] = wide_t{AB + (i + bi + tile_i) * ldab + (j + bj)};
-                                }
-
-                                // Compute C <- A*B
-                                for (int bk = 0; bk < real_K; bk++) {
-                                    const wide_t wb{work_B.data() + bk * ldwb + bj};
-                                    for (int tile_i = 0; tile_i < TILE_HEIGHT; tile_i++) {
-                                        c_tile[tile_i] = eve::fma(work_A[(bi + tile_i) * ldwa + bk], wb, c_tile[tile_i]);
-                                    }
-                                }
-
-                                // Store tile of C
-                                for (int tile_i = 0; tile_i < TILE_HEIGHT; tile_i++) {
-                                    eve::store(c_tile[tile_i], AB + (i + bi + tile_i) * ldab + (j + bj));
-                                }
-                                // End of kernel
+                        // the block of the panel starting at its column j
+                        const auto block_B = [=, &B](const int j) -> const T* {
+                            if constexpr (packed_B) {
+                                return B.block(k / BK, (jc + j) / BN);
+                            } else {
+                                return panel_B + (j / BN) * block_B_size;
                             }
-                        }
-                        // End of block
+                        };
+
+                        parallel_for(blocks_M * chunks_N, nb_threads, [=, &A, &block_B, &post](const int task, const int thread_id) {
+                            const int i = (task / chunks_N) * BM;
+                            const int j = (task % chunks_N) * chunk_width;
+                            const int real_M = std::min(M - i, BM);
+                            const int real_N = std::min(panel_N - j, chunk_width);
+                            if (real_N <= 0) {
+                                return;
+                            }
+
+                            T* work_A = work + thread_id * block_workspace_size(sizes);
+                            const epilogue<T> tile_post = post.from(i, jc + j);
+                            gemm_block<T, decltype(tile_height)::value>(real_M, real_N, real_K, alpha, A.from(i, k),
+                              [&](const int bj) { return block_B(j + bj); }, beta, k == 0, C + i * ldc + jc + j, ldc, sizes, work_A,
+                              last_K ? &tile_post : nullptr);
+                        });
                     }
                 }
-            }
+            });
+        }
+    } // namespace detail
+
+    /**
+     * @brief Sets the number of threads used by default by the matrix multiplications of the process.
+     *
+     * The initial value is read from the `GEMM_NUM_THREADS` environment variable, and defaults to 1. Values
+     * higher than the number of hardware threads are capped when running a multiplication.
+     */
+    inline void set_num_threads(const int nb_threads) {
+        detail::num_threads = std::max(nb_threads, 1);
+    }
+
+    /**
+     * @brief Returns the number of threads used by default by the matrix multiplications of the process.
+     */
+    inline int get_num_threads() {
+        return detail::num_threads;
+    }
 
-            for (int line = 0; line < M; line++) {
-                auto c = std::span(C + line * ldc, N);
-                auto ab = std::span(AB + line * ldab, N);
-                eve::algo::transform_to(eve::views::zip(ab, c), c, [alpha, beta](auto x) { return eve::fma(alpha, eve::get<0>(x), beta * eve::get<1>(x)); });
+    /**
+     * @brief Returns the number of elements of the workspace needed to multiply a `M x K` matrix by a `K x N` matrix
+     * using at most `nb_threads` threads, with the current block sizes of the process.
+     */
+    template<typename T>
+    std::size_t workspace_size(const int M, const int N, const int K, const int nb_threads = get_num_threads()) {
+        if (detail::is_small(M, N, K)) {
+            return detail::small_workspace_size(M, N, K);
+        } else if (detail::is_skinny(M, N)) {
+            return detail::skinny_workspace_size(M, N, K, std::clamp(nb_threads, 1, detail::max_threads()));
+        } else {
+            return detail::blocked_workspace_size<T>(get_blocking<T>(), N, std::clamp(nb_threads, 1, detail::max_threads()));
+        }
+    }
+
+    namespace detail
+    {
+        /**
+         * @brief Computes `C = alpha * op(A)op(B) + beta * C` with `gemm_small`, `gemm_skinny` or `gemm` depending on the dimensions,
+         * using at most `nb_threads` threads and the `workspace_size<T>(M, N, K, nb_threads)` elements of `work`. The
+         * operands are stored with the type `S`, which is either `T` or a 16-bit type converted when packing. The
+         * epilogue `post` is applied to `C` while it is stored.
+         */
+        template<typename T, typename S>
+        void multiply(const bool transA, const bool transB, const int M, const int N, const int K, const T alpha, const S* A, const int lda, const S* B,
+          const int ldb, const T beta, T* C, const int ldc, const int nb_threads, T* work, const epilogue<T>& post = {}) {
+            if (is_small(M, N, K)) {
+                gemm_small(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, work, post);
+            } else if (is_skinny(M, N)) {
+                gemm_skinny(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads, work, post);
+            } else {
+                gemm(M, N, K, alpha, operand<S>{A, lda, transA}, operand<S>{B, ldb, transB}, beta, C, ldc, get_blocking<T>(), nb_threads, work, post);
             }
         }
     } // namespace detail
 
     /**
-     * @brief Performs the operation `C = alpha * AB  + beta * C`.
+     * @brief Performs the operation `C = alpha * op(A)op(B)  + beta * C`, using at most `nb_threads` threads and the
+     * buffers of `ws` (which is grown if it is smaller than `workspace_size<T>(M, N, K, nb_threads)`).
      *
      * @note This function only chooses the appropriate function to call depending on the matrices' dimensions:
      * - If the matrices are small enough, we call `gemm_small` which directly calls the corresponding
      *   microkernel. Doing so allows to avoid the overhead of blocking/padding in the other version.
-     * - Otherwise, we call `gemm`.
+     *   This version always runs on the calling thread.
+     * - If `C` has at most a few rows or columns (matrix-vector products), we call `gemm_skinny`, which streams the
+     *   long operand once without packing nor padding it.
+     * - Otherwise, we call `gemm`, which splits the blocks of `C` between the threads.
      *
-     * @param M the number of rows of `A` and `C`
-     * @param N the number of columns of `B` and `C`
-     * @param K the number of columns of `A` / rows of `B`
-     * @param alpha The multiplier of `AB`
-     * @param A An array of size `M * lda`
+     * @param transA The operation applied to `A`: `op(A) = A` or `op(A) = A^T`
+     * @param transB The operation applied to `B`: `op(B) = B` or `op(B) = B^T`
+     * @param M the number of rows of `op(A)` and `C`
+     * @param N the number of columns of `op(B)` and `C`
+     * @param K the number of columns of `op(A)` / rows of `op(B)`
+     * @param alpha The multiplier of `op(A)op(B)`
+     * @param A An array of size `M * lda` (`K * lda` if `A` is transposed)
      * @param lda The "true" first dimension of `A`, that is the number of elements between two rows of `A`
-     *            as declared in the calling program. Note that `lda` >= `K` should hold true, otherwise the
-     *            behaviour is undefined.
-     * @param B An array of size `K * ldb`
+     *            as declared in the calling program. Note that `lda` >= `K` (`lda` >= `M` if `A` is transposed)
+     *            should hold true, otherwise the behaviour is undefined.
+     * @param B An array of size `K * ldb` (`N * ldb` if `B` is transposed)
      * @param ldb The "true" first dimension of `B`, that is the number of elements between two rows of `B`
-     *            as declared in the calling program. Note that `ldb` >= `N` should hold true, otherwise the
-     *            behaviour is undefined.
+     *            as declared in the calling program. Note that `ldb` >= `N` (`ldb` >= `K` if `B` is transposed)
+     *            should hold true, otherwise the behaviour is undefined.
      * @param beta The multiplier of `C`
      * @param C An array of size `M * ldc`
      * @param ldc The "true" first dimension of `C`, that is the number of elements between two rows of `C`
      *            as declared in the calling program. Note that `ldc` >= `N` should hold true, otherwise the
      *            behaviour is undefined.
+     * @param nb_threads The maximum number of threads to use
+     * @param ws The workspace used for the intermediate buffers
      */
     template<typename T>
-    void gemm(transposition, transposition, const int M, const int N, const int K, const T alpha, const T* A, const int lda, const T* B, const int ldb,
-      const T beta, T* C, const int ldc) {
-        // no transposition for the moment
-        if (M < 64 && N < 64 && K < 64) {
-            detail::gemm_small(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+    void gemm(transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const T* A, const int lda, const T* B,
+      const int ldb, const T beta, T* C, const int ldc, const int nb_threads, workspace<T>& ws) {
+        gemm<T>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, epilogue<T>{}, nb_threads, ws);
+    }
+
+    /**
+     * @brief Performs the operation `C = alpha * op(A)op(B)  + beta * C`, using at most `nb_threads` threads and the
+     * workspace of the calling thread.
+     */
+    template<typename T>
+    void gemm(transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const T* A, const int lda, const T* B,
+      const int ldb, const T beta, T* C, const int ldc, const int nb_threads) {
+        gemm<T>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads, detail::default_workspace<T>());
+    }
+
+    /**
+     * @brief Performs the operation `C = alpha * op(A)op(B)  + beta * C`, using the process wide number of threads
+     * (see `set_num_threads`).
+     */
+    template<typename T>
+    void gemm(transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const T* A, const int lda, const T* B,
+      const int ldb, const T beta, T* C, const int ldc) {
+        gemm<T>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, get_num_threads());
+    }
+
+    /**
+     * @brief Performs the operation `C = post(alpha * op(A)op(B)  + beta * C)`, using at most `nb_threads` threads and
+     * the buffers of `ws`.
+     *
+     * The epilogue (scaling vectors, bias vectors and activation, see `epilogue`) is applied to each tile of `C` as
+     * soon as its final value is stored, while the tile is still in cache, which saves the extra pass over `C` of
+     * applying it after the multiplication. The other parameters are the ones of `gemm`.
+     */
+    template<typename T>
+    void gemm(transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const T* A, const int lda, const T* B,
+      const int ldb, const T beta, T* C, const int ldc, const epilogue<T>& post, const int nb_threads, workspace<T>& ws) {
+        // the matrices are real, so a conjugate transposition is a simple transposition
+        const bool transposed_A = transA != transposition::none;
+        const bool transposed_B = transB != transposition::none;
+        const int threads = std::clamp(nb_threads, 1, detail::max_threads());
+        ws.reserve(workspace_size<T>(M, N, K, threads));
+        detail::multiply(transposed_A, transposed_B, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, threads, ws.data(), post);
+    }
+
+    /**
+     * @brief Performs the operation `C = post(alpha * op(A)op(B)  + beta * C)`, using at most `nb_threads` threads and
+     * the workspace of the calling thread.
+     */
+    template<typename T>
+    void gemm(transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const T* A, const int lda, const T* B,
+      const int ldb, const T beta, T* C, const int ldc, const epilogue<T>& post, const int nb_threads) {
+        gemm<T>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, post, nb_threads, detail::default_workspace<T>());
+    }
+
+    /**
+     * @brief Performs the operation `C = post(alpha * op(A)op(B)  + beta * C)`, using the process wide number of
+     * threads.
+     */
+    template<typename T>
+    void gemm(transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const T* A, const int lda, const T* B,
+      const int ldb, const T beta, T* C, const int ldc, const epilogue<T>& post) {
+        gemm<T>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, post, get_num_threads());
+    }
+
+    /**
+     * @brief Performs the operation `C = alpha * op(A)op(B)  + beta * C` on matrices stored with the given layout,
+     * using at most `nb_threads` threads and the buffers of `ws`.
+     *
+     * A column major matrix is the transpose of the row major matrix with the same storage, so the column major
+     * product is computed as the row major product `C^T = op(B)^T op(A)^T`, which swaps the operands and their
+     * dimensions. The transpositions are applied while packing as for row major matrices, so no copy is made and
+     * every combination of transpositions runs at the same speed in both layouts.
+     */
+    template<typename T>
+    void gemm(layout order, transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const T* A, const int lda,
+      const T* B, const int ldb, const T beta, T* C, const int ldc, const int nb_threads, workspace<T>& ws) {
+        if (order == layout::column_major) {
+            gemm<T>(transB, transA, N, M, K, alpha, B, ldb, A, lda, beta, C, ldc, nb_threads, ws);
         } else {
-            detail::gemm(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+            gemm<T>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads, ws);
         }
     }
 
     /**
-     * @brief Performs simple precision matrix-matrix multiplication.
+     * @brief Performs the operation `C = alpha * op(A)op(B)  + beta * C` on matrices stored with the given layout,
+     * using at most `nb_threads` threads and the workspace of the calling thread.
+     */
+    template<typename T>
+    void gemm(layout order, transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const T* A, const int lda,
+      const T* B, const int ldb, const T beta, T* C, const int ldc, const int nb_threads) {
+        gemm<T>(order, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads, detail::default_workspace<T>());
+    }
+
+    /**
+     * @brief Performs the operation `C = alpha * op(A)op(B)  + beta * C` on matrices stored with the given layout,
+     * using the process wide number of threads.
      */
-    inline auto sgemm = gemm<float>;
+    template<typename T>
+    void gemm(layout order, transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const T* A, const int lda,
+      const T* B, const int ldb, const T beta, T* C, const int ldc) {
+        gemm<T>(order, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, get_num_threads());
+    }
 
     /**
-     * @brief Performs double precision matrix-matrix multiplication.
+     * @brief Performs the operation `C = alpha * op(A)B  + beta * C`, where `B` has been packed beforehand, using at
+     * most `nb_threads` threads.
+     *
+     * The dimensions `K` and `N` are the ones of the packed matrix. As `B` is already in the layout used by the
+     * microkernels, no copy of `B` is made during the call. The buffers of `ws` are used as in the other overloads.
+     * The multiplication uses the `BK` and `BN` sizes `B` was packed with.
      */
-    inline auto dgemm = gemm<double>;
+    template<typename T>
+    void gemm(transposition transA, const int M, const T alpha, const T* A, const int lda, const packed_matrix<T>& B, const T beta, T* C, const int ldc,
+      const int nb_threads, workspace<T>& ws) {
+        const int N = B.cols();
+        const int K = B.rows();
+        const bool transposed_A = transA != transposition::none;
+        const int threads = std::clamp(nb_threads, 1, detail::max_threads());
+
+        // a block made of a single micro-panel is a row major matrix
+        if (detail::is_small(M, N, K) && B.nb_blocks() == 1 && N <= detail::TILE_WIDTH<T>) {
+            ws.reserve(detail::small_workspace_size(M, N, K));
+            detail::gemm_small(transposed_A, false, M, N, K, alpha, A, lda, B.block(0, 0), detail::TILE_WIDTH<T>, beta, C, ldc, ws.data());
+        } else {
+            blocking sizes = get_blocking<T>();
+            sizes.BK = B.block_sizes().BK;
+            sizes.BN = B.block_sizes().BN;
+            ws.reserve(detail::blocked_workspace_size<T>(sizes, N, threads, true));
+            const detail::operand<T> op_A{A, lda, transposed_A};
+            detail::gemm(M, N, K, alpha, op_A, B, beta, C, ldc, sizes, threads, ws.data());
+        }
+    }
+
+    /**
+     * @brief Performs the operation `C = alpha * op(A)B  + beta * C`, where `B` has been packed beforehand, using at
+     * most `nb_threads` threads and the workspace of the calling thread.
+     */
+    template<typename T>
+    void gemm(transposition transA, const int M, const T alpha, const T* A, const int lda, const packed_matrix<T>& B, const T beta, T* C, const int ldc,
+      const int nb_threads) {
+        gemm<T>(transA, M, alpha, A, lda, B, beta, C, ldc, nb_threads, detail::default_workspace<T>());
+    }
+
+    /**
+     * @brief Performs the operation `C = alpha * op(A)B  + beta * C`, where `B` has been packed beforehand, using
+     * the process wide number of threads.
+     */
+    template<typename T>
+    void gemm(transposition transA, const int M, const T alpha, const T* A, const int lda, const packed_matrix<T>& B, const T beta, T* C, const int ldc) {
+        gemm<T>(transA, M, alpha, A, lda, B, beta, C, ldc, get_num_threads());
+    }
+
+    /**
+     * @brief Performs simple precision matrix-matrix multiplication (see `gemm`).
+     */
+    inline void sgemm(transposition transA, transposition transB, const int M, const int N, const int K, const float alpha, const float* A, const int lda, const float* B,
+      const int ldb, const float beta, float* C, const int ldc) {
+        gemm<float>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+    }
+
+    /**
+     * @brief Performs simple precision matrix-matrix multiplication (see `gemm`).
+     */
+    inline void sgemm(transposition transA, transposition transB, const int M, const int N, const int K, const float alpha, const float* A, const int lda, const float* B,
+      const int ldb, const float beta, float* C, const int ldc, const int nb_threads) {
+        gemm<float>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads);
+    }
+
+    /**
+     * @brief Performs simple precision matrix-matrix multiplication (see `gemm`).
+     */
+    inline void sgemm(transposition transA, transposition transB, const int M, const int N, const int K, const float alpha, const float* A, const int lda, const float* B,
+      const int ldb, const float beta, float* C, const int ldc, const int nb_threads, workspace<float>& ws) {
+        gemm<float>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads, ws);
+    }
+
+    /**
+     * @brief Performs simple precision matrix-matrix multiplication followed by the epilogue `post` (see `gemm`).
+     */
+    inline void sgemm(transposition transA, transposition transB, const int M, const int N, const int K, const float alpha, const float* A, const int lda, const float* B,
+      const int ldb, const float beta, float* C, const int ldc, const epilogue<float>& post) {
+        gemm<float>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, post);
+    }
+
+    /**
+     * @brief Performs simple precision matrix-matrix multiplication followed by the epilogue `post` (see `gemm`).
+     */
+    inline void sgemm(transposition transA, transposition transB, const int M, const int N, const int K, const float alpha, const float* A, const int lda, const float* B,
+      const int ldb, const float beta, float* C, const int ldc, const epilogue<float>& post, const int nb_threads) {
+        gemm<float>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, post, nb_threads);
+    }
+
+    /**
+     * @brief Performs simple precision matrix-matrix multiplication followed by the epilogue `post` (see `gemm`).
+     */
+    inline void sgemm(transposition transA, transposition transB, const int M, const int N, const int K, const float alpha, const float* A, const int lda, const float* B,
+      const int ldb, const float beta, float* C, const int ldc, const epilogue<float>& post, const int nb_threads, workspace<float>& ws) {
+        gemm<float>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, post, nb_threads, ws);
+    }
+
+    /**
+     * @brief Performs simple precision matrix-matrix multiplication on matrices stored with the given layout (see `gemm`).
+     */
+    inline void sgemm(layout order, transposition transA, transposition transB, const int M, const int N, const int K, const float alpha, const float* A,
+      const int lda, const float* B, const int ldb, const float beta, float* C, const int ldc) {
+        gemm<float>(order, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+    }
+
+    /**
+     * @brief Performs simple precision matrix-matrix multiplication on matrices stored with the given layout (see `gemm`).
+     */
+    inline void sgemm(layout order, transposition transA, transposition transB, const int M, const int N, const int K, const float alpha, const float* A,
+      const int lda, const float* B, const int ldb, const float beta, float* C, const int ldc, const int nb_threads) {
+        gemm<float>(order, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads);
+    }
+
+    /**
+     * @brief Performs simple precision matrix-matrix multiplication on matrices stored with the given layout (see `gemm`).
+     */
+    inline void sgemm(layout order, transposition transA, transposition transB, const int M, const int N, const int K, const float alpha, const float* A,
+      const int lda, const float* B, const int ldb, const float beta, float* C, const int ldc, const int nb_threads, workspace<float>& ws) {
+        gemm<float>(order, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads, ws);
+    }
+
+    /**
+     * @brief Performs simple precision matrix-matrix multiplication by a packed matrix (see `gemm`).
+     */
+    inline void sgemm(transposition transA, const int M, const float alpha, const float* A, const int lda, const packed_matrix<float>& B, const float beta, float* C,
+      const int ldc) {
+        gemm<float>(transA, M, alpha, A, lda, B, beta, C, ldc);
+    }
+
+    /**
+     * @brief Performs simple precision matrix-matrix multiplication by a packed matrix (see `gemm`).
+     */
+    inline void sgemm(transposition transA, const int M, const float alpha, const float* A, const int lda, const packed_matrix<float>& B, const float beta, float* C,
+      const int ldc, const int nb_threads) {
+        gemm<float>(transA, M, alpha, A, lda, B, beta, C, ldc, nb_threads);
+    }
+
+    /**
+     * @brief Performs simple precision matrix-matrix multiplication by a packed matrix (see `gemm`).
+     */
+    inline void sgemm(transposition transA, const int M, const float alpha, const float* A, const int lda, const packed_matrix<float>& B, const float beta, float* C,
+      const int ldc, const int nb_threads, workspace<float>& ws) {
+        gemm<float>(transA, M, alpha, A, lda, B, beta, C, ldc, nb_threads, ws);
+    }
+
+    /**
+     * @brief Performs double precision matrix-matrix multiplication (see `gemm`).
+     */
+    inline void dgemm(transposition transA, transposition transB, const int M, const int N, const int K, const double alpha, const double* A, const int lda, const double* B,
+      const int ldb, const double beta, double* C, const int ldc) {
+        gemm<double>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+    }
+
+    /**
+     * @brief Performs double precision matrix-matrix multiplication (see `gemm`).
+     */
+    inline void dgemm(transposition transA, transposition transB, const int M, const int N, const int K, const double alpha, const double* A, const int lda, const double* B,
+      const int ldb, const double beta, double* C, const int ldc, const int nb_threads) {
+        gemm<double>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads);
+    }
+
+    /**
+     * @brief Performs double precision matrix-matrix multiplication (see `gemm`).
+     */
+    inline void dgemm(transposition transA, transposition transB, const int M, const int N, const int K, const double alpha, const double* A, const int lda, const double* B,
+      const int ldb, const double beta, double* C, const int ldc, const int nb_threads, workspace<double>& ws) {
+        gemm<double>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads, ws);
+    }
+
+    /**
+     * @brief Performs double precision matrix-matrix multiplication followed by the epilogue `post` (see `gemm`).
+     */
+    inline void dgemm(transposition transA, transposition transB, const int M, const int N, const int K, const double alpha, const double* A, const int lda, const double* B,
+      const int ldb, const double beta, double* C, const int ldc, const epilogue<double>& post) {
+        gemm<double>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, post);
+    }
+
+    /**
+     * @brief Performs double precision matrix-matrix multiplication followed by the epilogue `post` (see `gemm`).
+     */
+    inline void dgemm(transposition transA, transposition transB, const int M, const int N, const int K, const double alpha, const double* A, const int lda, const double* B,
+      const int ldb, const double beta, double* C, const int ldc, const epilogue<double>& post, const int nb_threads) {
+        gemm<double>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, post, nb_threads);
+    }
+
+    /**
+     * @brief Performs double precision matrix-matrix multiplication followed by the epilogue `post` (see `gemm`).
+     */
+    inline void dgemm(transposition transA, transposition transB, const int M, const int N, const int K, const double alpha, const double* A, const int lda, const double* B,
+      const int ldb, const double beta, double* C, const int ldc, const epilogue<double>& post, const int nb_threads, workspace<double>& ws) {
+        gemm<double>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, post, nb_threads, ws);
+    }
+
+    /**
+     * @brief Performs double precision matrix-matrix multiplication on matrices stored with the given layout (see `gemm`).
+     */
+    inline void dgemm(layout order, transposition transA, transposition transB, const int M, const int N, const int K, const double alpha, const double* A,
+      const int lda, const double* B, const int ldb, const double beta, double* C, const int ldc) {
+        gemm<double>(order, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+    }
+
+    /**
+     * @brief Performs double precision matrix-matrix multiplication on matrices stored with the given layout (see `gemm`).
+     */
+    inline void dgemm(layout order, transposition transA, transposition transB, const int M, const int N, const int K, const double alpha, const double* A,
+      const int lda, const double* B, const int ldb, const double beta, double* C, const int ldc, const int nb_threads) {
+        gemm<double>(order, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads);
+    }
+
+    /**
+     * @brief Performs double precision matrix-matrix multiplication on matrices stored with the given layout (see `gemm`).
+     */
+    inline void dgemm(layout order, transposition transA, transposition transB, const int M, const int N, const int K, const double alpha, const double* A,
+      const int lda, const double* B, const int ldb, const double beta, double* C, const int ldc, const int nb_threads, workspace<double>& ws) {
+        gemm<double>(order, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads, ws);
+    }
+
+    /**
+     * @brief Performs double precision matrix-matrix multiplication by a packed matrix (see `gemm`).
+     */
+    inline void dgemm(transposition transA, const int M, const double alpha, const double* A, const int lda, const packed_matrix<double>& B, const double beta, double* C,
+      const int ldc) {
+        gemm<double>(transA, M, alpha, A, lda, B, beta, C, ldc);
+    }
+
+    /**
+     * @brief Performs double precision matrix-matrix multiplication by a packed matrix (see `gemm`).
+     */
+    inline void dgemm(transposition transA, const int M, const double alpha, const double* A, const int lda, const packed_matrix<double>& B, const double beta, double* C,
+      const int ldc, const int nb_threads) {
+        gemm<double>(transA, M, alpha, A, lda, B, beta, C, ldc, nb_threads);
+    }
+
+    /**
+     * @brief Performs double precision matrix-matrix multiplication by a packed matrix (see `gemm`).
+     */
+    inline void dgemm(transposition transA, const int M, const double alpha, const double* A, const int lda, const packed_matrix<double>& B, const double beta, double* C,
+      const int ldc, const int nb_threads, workspace<double>& ws) {
+        gemm<double>(transA, M, alpha, A, lda, B, beta, C, ldc, nb_threads, ws);
+    }
 
 } // namespace gemm
 
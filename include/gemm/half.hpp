@@ -0,0 +1,406 @@
+#ifndef GEMM_HALF_HPP
+#define GEMM_HALF_HPP
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "gemm/gemm.hpp"
+
+namespace gemm
+{
+    /**
+     * @brief A 16-bit brain floating point number (bfloat16): the sign and 8-bit exponent of a `float`, and a 7-bit
+     * mantissa. It is a storage type, converted to `float` to be computed with.
+     */
+    struct bfloat16 {
+        std::uint16_t bits = 0;
+
+        bfloat16() = default;
+
+        /**
+         * @brief Rounds `value` to the nearest bfloat16 (ties to even).
+         */
+        constexpr explicit bfloat16(const float value) : bits(from_float(value)) {}
+
+        constexpr operator float() const {
+            return std::bit_cast<float>(static_cast<std::uint32_t>(bits) << 16);
+        }
+
+        /**
+         * @brief Converts `size` contiguous bfloat16 to `float` (used by the packing functions, see
+         * `detail::convert_elements`): a bfloat16 is the upper half of a `float`, so the elements are widened and
+         * shifted by whole registers.
+         */
+        friend void convert_elements(const bfloat16* src, const int size, float* dst) {
+            int i = 0;
+#if defined(__AVX2__)
+            for (; i + 8 <= size; i += 8) {
+                const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                _mm256_storeu_ps(dst + i, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(h), 16)));
+            }
+#elif defined(__SSE2__)
+            for (; i + 8 <= size; i += 8) {
+                const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                const __m128i zero = _mm_setzero_si128();
+                _mm_storeu_ps(dst + i, _mm_castsi128_ps(_mm_unpacklo_epi16(zero, h)));
+                _mm_storeu_ps(dst + i + 4, _mm_castsi128_ps(_mm_unpackhi_epi16(zero, h)));
+            }
+#endif
+            for (; i < size; i++) {
+                dst[i] = static_cast<float>(src[i]);
+            }
+        }
+
+        /**
+         * @brief Rounds `size` contiguous `float` to bfloat16 (ties to even) by whole registers, the NaNs being made
+         * quiet as by the constructor.
+         */
+        friend void convert_elements(const float* src, const int size, bfloat16* dst) {
+            int i = 0;
+#if defined(__AVX2__)
+            const __m256i magnitude_mask = _mm256_set1_epi32(0x7FFFFFFF);
+            const __m256i infinity = _mm256_set1_epi32(0x7F800000);
+            for (; i + 8 <= size; i += 8) {
+                const __m256i f = _mm256_castps_si256(_mm256_loadu_ps(src + i));
+                const __m256i high = _mm256_srli_epi32(f, 16);
+                const __m256i bias = _mm256_add_epi32(_mm256_set1_epi32(0x7FFF), _mm256_and_si256(high, _mm256_set1_epi32(1)));
+                const __m256i rounded = _mm256_srli_epi32(_mm256_add_epi32(f, bias), 16);
+                const __m256i nan = _mm256_cmpgt_epi32(_mm256_and_si256(f, magnitude_mask), infinity);
+                const __m256i h = _mm256_blendv_epi8(rounded, _mm256_or_si256(high, _mm256_set1_epi32(0x40)), nan);
+                // the 16-bit halves of both 128-bit lanes, brought together in the lower one
+                const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(h, h), 0xD8);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_castsi256_si128(packed));
+            }
+#endif
+            for (; i < size; i++) {
+                dst[i] = bfloat16(src[i]);
+            }
+        }
+
+      private:
+        static constexpr std::uint16_t from_float(const float value) {
+            const std::uint32_t f = std::bit_cast<std::uint32_t>(value);
+            if ((f & 0x7FFFFFFF) > 0x7F800000) {
+                return static_cast<std::uint16_t>((f >> 16) | 0x40); // quiet NaN
+            }
+            return static_cast<std::uint16_t>((f + 0x7FFF + ((f >> 16) & 1)) >> 16);
+        }
+    };
+
+    /**
+     * @brief A 16-bit IEEE 754 floating point number (binary16): a 5-bit exponent and a 10-bit mantissa. It is a
+     * storage type, converted to `float` to be computed with.
+     */
+    struct float16 {
+        std::uint16_t bits = 0;
+
+        float16() = default;
+
+        /**
+         * @brief Rounds `value` to the nearest float16 (ties to even), the values too large being rounded to
+         * infinity.
+         */
+        constexpr explicit float16(const float value) : bits(from_float(value)) {}
+
+        constexpr operator float() const {
+            const std::uint32_t sign = static_cast<std::uint32_t>(bits & 0x8000) << 16;
+            const std::uint32_t exponent = (bits >> 10) & 0x1F;
+            const std::uint32_t mantissa = bits & 0x3FF;
+
+            if (exponent == 0x1F) { // infinity or NaN
+                return std::bit_cast<float>(sign | 0x7F800000 | (mantissa << 13));
+            }
+            if (exponent == 0) { // zero or subnormal: mantissa * 2^-24
+                const float magnitude = static_cast<float>(mantissa) * 0x1p-24f;
+                return sign != 0 ? -magnitude : magnitude;
+            }
+            return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+        }
+
+        /**
+         * @brief Converts `size` contiguous float16 to `float` (used by the packing functions, see
+         * `detail::convert_elements`), with the F16C instructions when the target has them.
+         */
+        friend void convert_elements(const float16* src, const int size, float* dst) {
+            int i = 0;
+#if defined(__F16C__)
+            for (; i + 8 <= size; i += 8) {
+                _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+            }
+#endif
+            for (; i < size; i++) {
+                dst[i] = static_cast<float>(src[i]);
+            }
+        }
+
+        /**
+         * @brief Rounds `size` contiguous `float` to float16 (ties to even), with the F16C instructions when the
+         * target has them.
+         */
+        friend void convert_elements(const float* src, const int size, float16* dst) {
+            int i = 0;
+#if defined(__F16C__)
+            for (; i + 8 <= size; i += 8) {
+                const __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), h);
+            }
+#endif
+            for (; i < size; i++) {
+                dst[i] = float16(src[i]);
+            }
+        }
+
+      private:
+        static constexpr std::uint16_t from_float(const float value) {
+            const std::uint32_t f = std::bit_cast<std::uint32_t>(value);
+            const std::uint32_t sign = (f >> 16) & 0x8000;
+            const std::uint32_t magnitude = f & 0x7FFFFFFF;
+
+            std::uint32_t h = 0;
+            if (magnitude > 0x7F800000) { // NaN
+                h = 0x7E00;
+            } else if (magnitude >= 0x477FF000) { // rounds to more than 65504
+                h = 0x7C00;
+            } else if (magnitude >= 0x38800000) { // normal: rebias the exponent and round the mantissa
+                h = (magnitude - 0x38000000) >> 13;
+                const std::uint32_t rest = magnitude & 0x1FFF;
+                h += rest > 0x1000 || (rest == 0x1000 && (h & 1) != 0);
+            } else if (magnitude >= 0x33000000) { // subnormal: shift the mantissa with its implicit bit
+                const std::uint32_t mantissa = (magnitude & 0x7FFFFF) | 0x800000;
+                const std::uint32_t shift = 126 - (magnitude >> 23);
+                const std::uint32_t rest = mantissa & ((1u << shift) - 1);
+                const std::uint32_t half = 1u << (shift - 1);
+                h = mantissa >> shift;
+                h += rest > half || (rest == half && (h & 1) != 0);
+            }
+            return static_cast<std::uint16_t>(sign | h);
+        }
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Tells if `S` is one of the 16-bit storage types.
+         */
+        template<typename S>
+        constexpr bool is_half = std::is_same_v<S, bfloat16> || std::is_same_v<S, float16>;
+
+        /**
+         * @brief Block sizes of `gemm_half_C`: the K dimension is not split, so that each tile of `C` is computed and
+         * rounded once, and the blocks of `A` and `B` are narrowed to keep (at least) the area of the blocks of
+         * `sizes`.
+         */
+        template<typename T>
+        blocking half_C_blocking(const blocking& sizes, const int K) {
+            blocking whole_K = sizes;
+            whole_K.BK = std::max(K, 1);
+            whole_K.BM = round_block_size(static_cast<std::size_t>(sizes.BM) * sizes.BK / whole_K.BK, sizes.tile_height, sizes.BM);
+            whole_K.BN = round_block_size(static_cast<std::size_t>(sizes.BN) * sizes.BK / whole_K.BK, TILE_WIDTH<T>, sizes.BN);
+            return whole_K;
+        }
+
+        /**
+         * @brief Writes the `rows x cols` tile of products `ab` (`alpha` already applied, `TILE_WIDTH<T>` elements
+         * between two rows) to the 16-bit matrix `C`: `C = ab + beta * C`, each row of `C` being converted to `T` and
+         * rounded back by whole registers (`C` is not read if `beta` is 0).
+         */
+        template<typename T, typename S>
+        void store_half_tile(const int rows, const int cols, const T* ab, const T beta, S* C, const int ldc) {
+            std::array<T, TILE_WIDTH<T>> c_row;
+            for (int r = 0; r < rows; r++) {
+                const T* ab_row = ab + r * TILE_WIDTH<T>;
+                S* c = C + r * ldc;
+                if (beta == T{0}) {
+                    convert_elements(ab_row, cols, c);
+                } else {
+                    convert_elements(c, cols, c_row.data());
+                    for (int x = 0; x < cols; x++) {
+                        c_row[x] = ab_row[x] + beta * c_row[x];
+                    }
+                    convert_elements(c_row.data(), cols, c);
+                }
+            }
+        }
+
+        /**
+         * @brief Multiplies a block of `M` rows of `op(A)` by the packed blocks of `B` covering `N` columns, for the
+         * whole K dimension, writing the products to the 16-bit matrix `C`.
+         *
+         * The loops are the ones of `gemm_block`, but each tile is computed in a `T` array (with `beta` = 0), then
+         * added to `C` and rounded by `store_half_tile`, so `C` is converted while it is stored.
+         */
+        template<typename T, int TILE_HEIGHT, typename S, typename BlockB>
+        void half_block(const int M, const int N, const int K, const T alpha, const operand<S>& A, const BlockB& block_B, const T beta, S* C,
+          const int ldc, const blocking& sizes, T* work_A) {
+            const int BN = sizes.BN;
+            constexpr auto TILE_WIDTH = gemm::detail::TILE_WIDTH<T>;
+            constexpr int wide_size = eve::wide<T>::size();
+
+            pack_block_A(A, M, K, TILE_HEIGHT, work_A);
+
+            for (int bj = 0; bj < N; bj += BN) {
+                const int real_N = std::min(N - bj, BN);
+                const T* packed_B = block_B(bj);
+
+                for (int ti = 0; ti < M; ti += TILE_HEIGHT) {
+                    const int rows = std::min(M - ti, TILE_HEIGHT);
+                    const T* panel_A = work_A + ti * K;
+                    for (int tj = 0; tj < real_N; tj += TILE_WIDTH) {
+                        const int cols = std::min(real_N - tj, TILE_WIDTH);
+                        const int wides = (cols + wide_size - 1) / wide_size;
+
+                        std::array<T, TILE_HEIGHT * TILE_WIDTH> ab;
+                        fringe_tiles<T, TILE_HEIGHT>[rows - 1][wides - 1](K, panel_A, packed_B + tj * K, cols, alpha, T{0}, true, ab.data(), TILE_WIDTH);
+                        store_half_tile(rows, cols, ab.data(), beta, C + ti * ldc + (bj + tj), ldc);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Computes `C = alpha * op(A)op(B) + beta * C`, `C` being stored with the 16-bit type `S`.
+         *
+         * The loops and the tasks are the ones of `gemm`, with a single K block (see `half_C_blocking`): each tile is
+         * accumulated in registers for the whole K dimension, then rounded once while it is stored, so no `T` copy of
+         * `C` is needed. `work` holds `blocked_workspace_size<T>(half_C_blocking<T>(sizes, K), N, nb_threads)`
+         * elements.
+         */
+        template<typename T, typename S>
+        void gemm_half_C(const int M, const int N, const int K, const T alpha, const operand<S>& A, const operand<S>& B, const T beta, S* C,
+          const int ldc, const blocking& sizes, const int nb_threads, T* work) {
+            if (M == 0 || N == 0) {
+                return;
+            }
+            if (K == 0) {
+                // C = beta * C, C is not read if beta is 0
+                const std::array<T, TILE_WIDTH<T>> zeros{};
+                for (int i = 0; i < M; i++) {
+                    for (int j = 0; j < N; j += TILE_WIDTH<T>) {
+                        store_half_tile(1, std::min(N - j, TILE_WIDTH<T>), zeros.data(), beta, C + i * ldc + j, ldc);
+                    }
+                }
+                return;
+            }
+
+            const blocking whole_K = half_C_blocking<T>(sizes, K);
+            const int BM = whole_K.BM;
+            const int BN = whole_K.BN;
+            const int NC = panel_width<T>(whole_K, N);
+            const std::size_t block_B_size = static_cast<std::size_t>(K) * BN;
+            T* panel_B = work + nb_threads * block_workspace_size(whole_K);
+
+            const int blocks_M = (M + BM - 1) / BM;
+            const int wanted_tasks = nb_threads > 1 ? 2 * nb_threads : 1;
+
+            with_tile_height(whole_K.tile_height, [&](auto tile_height) {
+                for (int jc = 0; jc < N; jc += NC) {
+                    const int panel_N = std::min(N - jc, NC);
+
+                    // task decomposition
+                    const int blocks_N = (panel_N + BN - 1) / BN;
+                    const int chunks_N = std::min(blocks_N, (wanted_tasks + blocks_M - 1) / blocks_M);
+                    const int chunk_width = ((blocks_N + chunks_N - 1) / chunks_N) * BN;
+
+                    parallel_for(blocks_N, nb_threads, [=, &B](const int bj, int) {
+                        const int j = bj * BN;
+                        pack_block_B(B, 0, jc + j, K, std::min(panel_N - j, BN), panel_B + bj * block_B_size);
+                    });
+
+                    parallel_for(blocks_M * chunks_N, nb_threads, [=, &A](const int task, const int thread_id) {
+                        const int i = (task / chunks_N) * BM;
+                        const int j = (task % chunks_N) * chunk_width;
+                        const int real_M = std::min(M - i, BM);
+                        const int real_N = std::min(panel_N - j, chunk_width);
+                        if (real_N <= 0) {
+                            return;
+                        }
+
+                        T* work_A = work + thread_id * block_workspace_size(whole_K);
+                        half_block<T, decltype(tile_height)::value>(real_M, real_N, K, alpha, A.from(i, 0),
+                          [=](const int bj) -> const T* { return panel_B + ((j + bj) / BN) * block_B_size; }, beta, C + i * ldc + jc + j, ldc,
+                          whole_K, work_A);
+                    });
+                }
+            });
+        }
+    } // namespace detail
+
+    /**
+     * @brief Returns the number of elements of the workspace needed to multiply 16-bit matrices with `gemm`, and to
+     * write a 16-bit `C` if `half_C` is true (the K dimension is then not split, see `detail::gemm_half_C`).
+     */
+    template<typename T>
+    std::size_t half_workspace_size(const int M, const int N, const int K, const int nb_threads = get_num_threads(), const bool half_C = false) {
+        if (half_C) {
+            const blocking sizes = detail::half_C_blocking<T>(get_blocking<T>(), K);
+            return detail::blocked_workspace_size<T>(sizes, N, std::clamp(nb_threads, 1, detail::max_threads()));
+        }
+        return workspace_size<T>(M, N, K, nb_threads);
+    }
+
+    /**
+     * @brief Performs the operation `C = alpha * op(A)op(B)  + beta * C`, `A` and `B` being stored with the 16-bit type
+     * `S` (`bfloat16` or `float16`), using at most `nb_threads` threads and the buffers of `ws`.
+     *
+     * The elements of `A` and `B` are converted to `T` (`float`) while they are packed, so the products are
+     * accumulated with the precision of `T` and only half of the memory of `float` operands is read. The other
+     * parameters are the ones of the `float` multiplication.
+     */
+    template<typename T, typename S>
+        requires detail::is_half<S>
+    void gemm(transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const S* A, const int lda, const S* B,
+      const int ldb, const T beta, T* C, const int ldc, const int nb_threads, workspace<T>& ws) {
+        const int threads = std::clamp(nb_threads, 1, detail::max_threads());
+        ws.reserve(half_workspace_size<T>(M, N, K, threads));
+        detail::multiply(transA != transposition::none, transB != transposition::none, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, threads, ws.data());
+    }
+
+    /**
+     * @brief Performs the operation `C = alpha * op(A)op(B)  + beta * C`, `A`, `B` and `C` being stored with the
+     * 16-bit type `S`, using at most `nb_threads` threads and the buffers of `ws`.
+     *
+     * Each tile of the product is accumulated in registers with the precision of `T` (`float`) for the whole K
+     * dimension, then added to `C` and rounded once while it is stored.
+     */
+    template<typename T, typename S>
+        requires detail::is_half<S>
+    void gemm(transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const S* A, const int lda, const S* B,
+      const int ldb, const T beta, S* C, const int ldc, const int nb_threads, workspace<T>& ws) {
+        const int threads = std::clamp(nb_threads, 1, detail::max_threads());
+        ws.reserve(half_workspace_size<T>(M, N, K, threads, true));
+        const detail::operand<S> op_A{A, lda, transA != transposition::none};
+        const detail::operand<S> op_B{B, ldb, transB != transposition::none};
+        detail::gemm_half_C(M, N, K, alpha, op_A, op_B, beta, C, ldc, get_blocking<T>(), threads, ws.data());
+    }
+
+    /**
+     * @brief Performs the multiplication of 16-bit matrices using at most `nb_threads` threads and the workspace of
+     * the calling thread.
+     */
+    template<typename T, typename S, typename CType>
+        requires detail::is_half<S> && (std::is_same_v<CType, T> || std::is_same_v<CType, S>)
+    void gemm(transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const S* A, const int lda, const S* B,
+      const int ldb, const T beta, CType* C, const int ldc, const int nb_threads) {
+        gemm<T>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads, detail::default_workspace<T>());
+    }
+
+    /**
+     * @brief Performs the multiplication of 16-bit matrices using the process wide number of threads.
+     */
+    template<typename T, typename S, typename CType>
+        requires detail::is_half<S> && (std::is_same_v<CType, T> || std::is_same_v<CType, S>)
+    void gemm(transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const S* A, const int lda, const S* B,
+      const int ldb, const T beta, CType* C, const int ldc) {
+        gemm<T>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, get_num_threads());
+    }
+} // namespace gemm
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef GEMM_PACKED_MATRIX_HPP
+#define GEMM_PACKED_MATRIX_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include "gemm/detail/blocking.hpp"
+#include "gemm/detail/pack.hpp"
+#include "gemm/tuning.hpp"
+#include "gemm/types.hpp"
+
+namespace gemm
+{
+    /**
+     * @brief A `K x N` matrix packed once in the layout read by the microkernels, to be used as the right
+     * operand of many multiplications.
+     *
+     * The matrix is stored as a grid of `BK x BN` blocks padded with zeros, the blocks of a same row being
+     * contiguous. Each block is made of the micro-panels read by the microkernel (see `detail::pack_B_panels`).
+     * The block sizes are the ones of the process (see `get_blocking`) when the matrix is packed, and the
+     * multiplications using it keep them.
+     */
+    template<typename T>
+    class packed_matrix
+    {
+      public:
+        packed_matrix() = default;
+
+        /**
+         * @brief Packs the matrix `op(B)`.
+         *
+         * @param trans The operation applied to `B`
+         * @param K The number of rows of `op(B)`
+         * @param N The number of columns of `op(B)`
+         * @param B An array of size `K * ldb` (`N * ldb` if `B` is transposed)
+         * @param ldb The number of elements between two rows of `B`
+         */
+        packed_matrix(transposition trans, const int K, const int N, const T* B, const int ldb)
+          : K(K), N(N), sizes(get_blocking<T>()), blocks_K((K + sizes.BK - 1) / sizes.BK), blocks_N((N + sizes.BN - 1) / sizes.BN),
+            data(static_cast<std::size_t>(blocks_K) * blocks_N * block_size()) {
+            const detail::operand<T> op_B{B, ldb, trans != transposition::none};
+
+            for (int bk = 0; bk < blocks_K; bk++) {
+                const int k = bk * sizes.BK;
+                const int real_K = std::min(K - k, sizes.BK);
+                for (int bj = 0; bj < blocks_N; bj++) {
+                    const int j = bj * sizes.BN;
+                    const int real_N = std::min(N - j, sizes.BN);
+                    detail::pack_B_panels(
+                      op_B.transposed, real_K, real_N, op_B.at(k, j), op_B.ld, detail::TILE_WIDTH<T>, data.data() + block_offset(bk, bj));
+                }
+            }
+        }
+
+        /**
+         * @brief Number of rows of the packed matrix.
+         */
+        int rows() const {
+            return K;
+        }
+
+        /**
+         * @brief Number of columns of the packed matrix.
+         */
+        int cols() const {
+            return N;
+        }
+
+        /**
+         * @brief Number of blocks the matrix is made of.
+         */
+        int nb_blocks() const {
+            return blocks_K * blocks_N;
+        }
+
+        /**
+         * @brief Block sizes used when packing the matrix, the multiplications using it have the same `BK` and `BN`.
+         */
+        const blocking& block_sizes() const {
+            return sizes;
+        }
+
+        /**
+         * @brief Address of the block in the `bk`-th block row and the `bj`-th block column.
+         */
+        const T* block(const int bk, const int bj) const {
+            return data.data() + block_offset(bk, bj);
+        }
+
+      private:
+        std::size_t block_size() const {
+            return static_cast<std::size_t>(sizes.BK) * sizes.BN;
+        }
+
+        std::size_t block_offset(const int bk, const int bj) const {
+            return (static_cast<std::size_t>(bk) * blocks_N + bj) * block_size();
+        }
+
+        int K = 0;
+        int N = 0;
+        blocking sizes = detail::default_blocking<T>;
+        int blocks_K = 0;
+        int blocks_N = 0;
+        std::vector<T> data;
+    };
+} // namespace gemm
+
+#endif
@@ -0,0 +1,124 @@
+#ifndef GEMM_PLAN_HPP
+#define GEMM_PLAN_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "gemm/gemm.hpp"
+
+namespace gemm
+{
+    /**
+     * @brief A multiplication of fixed dimensions, transpositions and leading dimensions, prepared once to be executed
+     * many times.
+     *
+     * The plan makes the choices `gemm` makes at each call when it is built: the algorithm used for the dimensions,
+     * the block sizes (the ones of the process when the plan is built, which later calls to `set_blocking` do not
+     * change), the number of threads, and, for small matrices, the decomposition of the product in kernels, stored as
+     * a flat list of kernel pointers and offsets. It owns its workspace, so executing it neither allocates nor
+     * recomputes any of these choices. A plan is executed by one thread at a time, as it writes its workspace.
+     */
+    template<typename T>
+    class gemm_plan
+    {
+      public:
+        gemm_plan() = default;
+
+        /**
+         * @brief Prepares the multiplication `C = alpha * op(A)op(B)  + beta * C` of the given shape using at most
+         * `nb_threads` threads. The parameters are the ones of `gemm`.
+         */
+        gemm_plan(transposition transA, transposition transB, const int M, const int N, const int K, const int lda, const int ldb, const int ldc,
+          const int nb_threads = get_num_threads())
+          : transA(transA != transposition::none), transB(transB != transposition::none), M(M), N(N), K(K), lda(lda), ldb(ldb), ldc(ldc),
+            threads(std::clamp(nb_threads, 1, detail::max_threads())), sizes(get_blocking<T>()) {
+            if (detail::is_small(M, N, K)) {
+                algorithm = path::small;
+                ws.reserve(detail::small_workspace_size(M, N, K));
+                // the transposed operands are copied to the workspace as row major matrices, the kernels need non
+                // empty matrices (an empty product only scales C)
+                kernel_lda = this->transA ? K : lda;
+                kernel_ldb = this->transB ? N : ldb;
+                if (M > 0 && N > 0 && K > 0) {
+                    detail::plan_kernels(M, N, K, kernel_lda, kernel_ldb, ldc, 0, 0, 0, false, calls);
+                }
+            } else if (detail::is_skinny(M, N)) {
+                algorithm = path::skinny;
+                ws.reserve(detail::skinny_workspace_size(M, N, K, threads));
+            } else {
+                algorithm = path::blocked;
+                ws.reserve(detail::blocked_workspace_size<T>(sizes, N, threads));
+            }
+        }
+
+        /**
+         * @brief Performs the operation `C = post(alpha * op(A)op(B)  + beta * C)` with the shape of the plan.
+         */
+        void execute(const T alpha, const T* A, const T* B, const T beta, T* C, const epilogue<T>& post = {}) {
+            switch (algorithm) {
+            case path::small:
+                execute_small(alpha, A, B, beta, C);
+                if (post.active()) {
+                    post.apply(M, N, C, ldc);
+                }
+                break;
+            case path::skinny:
+                detail::gemm_skinny(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, threads, ws.data(), post);
+                break;
+            case path::blocked:
+                detail::gemm(M, N, K, alpha, detail::operand<T>{A, lda, transA}, detail::operand<T>{B, ldb, transB}, beta, C, ldc, sizes, threads,
+                  ws.data(), post);
+                break;
+            }
+        }
+
+      private:
+        enum class path {
+            small,
+            skinny,
+            blocked
+        };
+
+        /**
+         * @brief Replays the kernel calls of the small multiplication, after copying the transposed operands.
+         */
+        void execute_small(const T alpha, const T* A, const T* B, const T beta, T* C) {
+            if (K == 0) {
+                detail::scale_matrix(M, N, beta, C, ldc);
+                return;
+            }
+
+            T* work_A = ws.data();
+            T* work_B = work_A + M * K;
+            if (transA) {
+                detail::pack_block(true, M, K, A, lda, work_A, K);
+                A = work_A;
+            }
+            if (transB) {
+                detail::pack_block(true, K, N, B, ldb, work_B, N);
+                B = work_B;
+            }
+
+            detail::run_kernels<T>(calls, alpha, A, kernel_lda, B, kernel_ldb, beta, C, ldc);
+        }
+
+        bool transA = false;
+        bool transB = false;
+        int M = 0;
+        int N = 0;
+        int K = 0;
+        int lda = 0;
+        int ldb = 0;
+        int ldc = 0;
+        int threads = 1;
+        blocking sizes = detail::default_blocking<T>;
+        path algorithm = path::blocked;
+        int kernel_lda = 0;
+        int kernel_ldb = 0;
+        std::vector<detail::kernel_call<T>> calls;
+        workspace<T> ws;
+    };
+} // namespace gemm
+
+#endif
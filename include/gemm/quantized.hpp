@@ -0,0 +1,623 @@
+#ifndef GEMM_QUANTIZED_HPP
+#define GEMM_QUANTIZED_HPP
+
+#include <eve/eve.hpp>
+#include <eve/module/core.hpp>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "gemm/gemm.hpp"
+
+namespace gemm
+{
+    /**
+     * @brief Quantization parameters of a `u8 x s8` multiplication.
+     *
+     * The real value of an element `x` of `A` (`B`) is `scale * (x - zero_point_A)` (`zero_point_B`). The product of
+     * the integers minus the zero points is accumulated on 32 bits, then scaled by `row_scales[i] * col_scales[j]`
+     * for the element (i, j) of a `float` or 8-bit `C` (a missing array being a scale of 1), `zero_point_C` being
+     * added to an 8-bit `C`.
+     */
+    struct quantization {
+        std::int32_t zero_point_A = 0;
+        std::int32_t zero_point_B = 0;
+        const float* row_scales = nullptr; // M scales, typically the scale of A times a per row factor
+        const float* col_scales = nullptr; // N scales, typically the per channel scales of B
+        std::int32_t zero_point_C = 0;
+    };
+
+    namespace detail
+    {
+        using qwide = eve::wide<std::int32_t>;
+
+        // a row of a micro-panel of B: as many 8-bit elements as 32-bit lanes, sign extended when loaded
+        using qwide_s8 = eve::wide<std::int8_t, eve::fixed<qwide::size()>>;
+
+        // the tile of the 32-bit accumulators has the shape of the floating point ones
+        constexpr int QTILE_HEIGHT = TILE_HEIGHT<std::int32_t>;
+        constexpr int QTILE_WIDES = TILE_WIDES<std::int32_t>;
+        constexpr int QTILE_WIDTH = TILE_WIDTH<std::int32_t>;
+
+        /**
+         * @brief Dot product instructions for a register of `Lanes` 32-bit lanes, which multiply the groups of 4
+         * unsigned bytes of `a` by the groups of 4 signed bytes of `b` and add the sums to the lanes of an accumulator.
+         * Only the specializations of the target have them (`available`).
+         */
+        template<std::ptrdiff_t Lanes>
+        struct quantized_dot {
+            static constexpr bool available = false;
+        };
+
+#if defined(__AVX2__)
+        template<>
+        struct quantized_dot<8> {
+            static constexpr bool available = true;
+            using reg = __m256i;
+
+            static reg zero() {
+                return _mm256_setzero_si256();
+            }
+
+            static reg load(const std::int8_t* b) {
+                return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b));
+            }
+
+            /**
+             * @brief Adds the dot products of the 4 bytes of `a` and the groups of 4 bytes of `b` to `acc`.
+             *
+             * Without VNNI, `vpmaddubsw` adds pairs of products on 16 bits with saturation, and two products reach
+             * 2 * 255 * 128 > 32767. The even and odd bytes of `a` are thus multiplied separately: each 16-bit sum is a
+             * single exact product, then `vpmaddwd` adds them pairwise on 32 bits.
+             */
+            static reg add(const reg acc, const std::uint32_t a, const reg b) {
+#if defined(__AVXVNNI__)
+                return _mm256_dpbusd_avx_epi32(acc, _mm256_set1_epi32(static_cast<int>(a)), b);
+#elif defined(__AVX512VNNI__) && defined(__AVX512VL__)
+                return _mm256_dpbusd_epi32(acc, _mm256_set1_epi32(static_cast<int>(a)), b);
+#else
+                const reg ones = _mm256_set1_epi16(1);
+                const reg even = _mm256_maddubs_epi16(_mm256_set1_epi32(static_cast<int>(a & 0x00FF00FF)), b);
+                const reg odd = _mm256_maddubs_epi16(_mm256_set1_epi32(static_cast<int>(a & 0xFF00FF00)), b);
+                return _mm256_add_epi32(acc, _mm256_add_epi32(_mm256_madd_epi16(even, ones), _mm256_madd_epi16(odd, ones)));
+#endif
+            }
+        };
+#endif
+
+#if defined(__AVX512BW__)
+        template<>
+        struct quantized_dot<16> {
+            static constexpr bool available = true;
+            using reg = __m512i;
+
+            static reg zero() {
+                return _mm512_setzero_si512();
+            }
+
+            static reg load(const std::int8_t* b) {
+                return _mm512_loadu_si512(b);
+            }
+
+            /**
+             * @brief Adds the dot products of the 4 bytes of `a` and the groups of 4 bytes of `b` to `acc`, the even and
+             * odd bytes of `a` being multiplied separately without VNNI (see `quantized_dot<8>::add`).
+             */
+            static reg add(const reg acc, const std::uint32_t a, const reg b) {
+#if defined(__AVX512VNNI__)
+                return _mm512_dpbusd_epi32(acc, _mm512_set1_epi32(static_cast<int>(a)), b);
+#else
+                const reg ones = _mm512_set1_epi16(1);
+                const reg even = _mm512_maddubs_epi16(_mm512_set1_epi32(static_cast<int>(a & 0x00FF00FF)), b);
+                const reg odd = _mm512_maddubs_epi16(_mm512_set1_epi32(static_cast<int>(a & 0xFF00FF00)), b);
+                return _mm512_add_epi32(acc, _mm512_add_epi32(_mm512_madd_epi16(even, ones), _mm512_madd_epi16(odd, ones)));
+#endif
+            }
+        };
+#endif
+
+        /**
+         * @brief Number of consecutive K interleaved in the packed micro-panels: 4 when `qwide` has dot product
+         * instructions (see `quantized_dot`), so that a register of `B` holds 4 K of each of its columns, 1 otherwise.
+         */
+        constexpr int QK = quantized_dot<qwide::size()>::available ? 4 : 1;
+
+        /**
+         * @brief Number of K of the packed micro-panels for `K` columns of `op(A)`: `K` rounded up to whole groups of
+         * `QK`, the last group being padded with zeros.
+         */
+        constexpr int quantized_length(const int K) {
+            return (K + QK - 1) / QK * QK;
+        }
+
+        /**
+         * @brief Block sizes of the quantized multiplication. The packed elements take a single byte, so the K blocks
+         * are longer than the floating point ones for the same cache footprint.
+         */
+        constexpr blocking quantized_blocking = {40 * QTILE_HEIGHT, 8 * QTILE_WIDTH, 256, QTILE_HEIGHT};
+
+        /**
+         * @brief Largest K of the 32-bit sums of the quantized multiplication: a product of a `u8` and a `s8` takes at
+         * most 16 bits, so the sums of up to 65536 products cannot overflow.
+         */
+        constexpr int quantized_max_K = 65536;
+
+        /**
+         * @brief Largest K of a quantized multiplication to a `C` of type `Out`. The tiles of a `float` or 8-bit `C`
+         * accumulate the sums of parts of `quantized_max_K` elements in single precision, their K being only bounded by
+         * the 32-bit sums of the rows of `op(A)` (used with the zero point of `B`).
+         */
+        template<typename Out>
+        constexpr int quantized_K_limit = std::is_same_v<Out, std::int32_t> ? quantized_max_K : std::numeric_limits<std::int32_t>::max() / 255;
+
+        /**
+         * @brief Block sizes of a quantized multiplication over `K` columns/rows. A `C` which is not a 32-bit matrix
+         * cannot hold the partial sums of the K blocks, so its K dimension is not split: each tile is accumulated in
+         * registers for the whole K dimension, and the blocks of `A` and `B` are narrowed to keep (at least) the area of
+         * the blocks of `quantized_blocking`.
+         */
+        constexpr blocking quantized_sizes(const int K, const bool int32_C) {
+            blocking sizes = quantized_blocking;
+            if (!int32_C && K > sizes.BK) {
+                sizes.BK = quantized_length(K);
+                const std::size_t area = static_cast<std::size_t>(quantized_blocking.BK);
+                sizes.BM = round_block_size(area * quantized_blocking.BM / K, QTILE_HEIGHT, quantized_blocking.BM);
+                sizes.BN = round_block_size(area * quantized_blocking.BN / K, QTILE_WIDTH, quantized_blocking.BN);
+            }
+            return sizes;
+        }
+
+        /**
+         * @brief Output of the quantized multiplication: applies the zero point compensation and the scales to the
+         * 32-bit sums, and stores them in `C` (of type `Out`: `std::int32_t`, `float` or `std::uint8_t`).
+         *
+         * With `za` and `zb` the zero points, `sum_k (a - za)(b - zb) = sum_k ab - zb * rows_A[i] - za * cols_B[j] + K za zb`,
+         * `rows_A` (`cols_B`) holding the sums of the rows of `op(A)` (columns of `op(B)`), which are only needed if `zb`
+         * (`za`) is not 0. The terms of the zero points are computed on 64 bits and truncated, as the 32-bit sums wrap
+         * around, so the result is exact whenever it fits on 32 bits. The partial sums of the K blocks before the last
+         * one are kept in `acc`, which is `C` itself (the K dimension is only split for a 32-bit `C`). The sums of a K
+         * longer than `quantized_max_K` are accumulated in single precision, and so are their zero point terms.
+         */
+        template<typename Out>
+        struct quantized_output {
+            Out* C;
+            int ldc;
+            std::int32_t* acc;
+            int ld_acc;
+            const std::int32_t* rows_A;
+            const std::int32_t* cols_B;
+            quantization params;
+            int K;
+
+            /**
+             * @brief Stores the `lanes` first sums of `ab`, the elements (i, j) to (i, j + lanes - 1) of `AB`.
+             */
+            void store(const int i, const int j, qwide ab, const int lanes) const {
+                const auto keep = eve::ignore_last(qwide::size() - lanes);
+                const std::int64_t zero_points = std::int64_t{K} * params.zero_point_A * params.zero_point_B;
+                ab += qwide{static_cast<std::int32_t>(zero_points)};
+                if (params.zero_point_B != 0) {
+                    ab -= qwide{static_cast<std::int32_t>(std::int64_t{params.zero_point_B} * rows_A[i])};
+                }
+                if (params.zero_point_A != 0) {
+                    ab -= qwide{params.zero_point_A} * eve::load[keep](cols_B + j);
+                }
+
+                if constexpr (std::is_same_v<Out, std::int32_t>) {
+                    eve::store[keep](ab, C + i * ldc + j);
+                } else {
+                    output(i, j, eve::convert(ab, eve::as<float>{}), lanes);
+                }
+            }
+
+            /**
+             * @brief Stores the `lanes` first sums of `ab` accumulated in single precision (see
+             * `compute_long_quantized_tile`) in a `float` or 8-bit `C`.
+             */
+            void store(const int i, const int j, eve::wide<float> ab, const int lanes) const {
+                using wide_f = eve::wide<float>;
+                const auto keep = eve::ignore_last(qwide::size() - lanes);
+                ab += wide_f{static_cast<float>(std::int64_t{K} * params.zero_point_A * params.zero_point_B)};
+                if (params.zero_point_B != 0) {
+                    ab -= wide_f{static_cast<float>(std::int64_t{params.zero_point_B} * rows_A[i])};
+                }
+                if (params.zero_point_A != 0) {
+                    ab -= wide_f{static_cast<float>(params.zero_point_A)} * eve::convert(eve::load[keep](cols_B + j), eve::as<float>{});
+                }
+                output(i, j, ab, lanes);
+            }
+
+            /**
+             * @brief Scales the `lanes` first values of `value` and stores them in a `float` or 8-bit `C`.
+             */
+            void output(const int i, const int j, eve::wide<float> value, const int lanes) const {
+                using wide_f = eve::wide<float>; // as many lanes as qwide
+                const auto keep = eve::ignore_last(qwide::size() - lanes);
+                if (params.row_scales != nullptr) {
+                    value *= wide_f{params.row_scales[i]};
+                }
+                if (params.col_scales != nullptr) {
+                    value *= eve::load[keep](params.col_scales + j);
+                }
+
+                Out* c = C + i * ldc + j;
+                if constexpr (std::is_same_v<Out, float>) {
+                    eve::store[keep](value, c);
+                } else {
+                    // requantization: rounded to the nearest integer and saturated
+                    value = eve::clamp(eve::nearest(value) + wide_f{static_cast<float>(params.zero_point_C)}, wide_f{0.0f}, wide_f{255.0f});
+                    eve::store[keep](eve::convert(eve::convert(value, eve::as<std::int32_t>{}), eve::as<std::uint8_t>{}), c);
+                }
+            }
+        };
+
+        /**
+         * @brief Computes the 32-bit sums of products of a micro-panel of `A` (`MR` rows of unsigned 8-bit integers) and
+         * the first `NW` registers of a micro-panel of `B` (`QTILE_WIDTH` columns of signed 8-bit integers) over `K`
+         * columns/rows (a multiple of `QK`), packed by `pack_quantized_panels`.
+         *
+         * With the dot product instructions of the target (`QK` is 4), a group of 4 K of a row of `A` is broadcast and
+         * multiplied by the registers of `B` holding the same 4 K of each column. Otherwise the rows of `B` are widened to
+         * 32 bits by eve when they are loaded, each one being used for the `MR` rows of the tile. A product takes at most
+         * 16 bits, so the sums cannot overflow for `K` up to `quantized_max_K`.
+         */
+        template<int MR, int NW>
+        void quantized_microkernel(const int K, const std::uint8_t* a, const std::int8_t* b, tile<std::int32_t, MR, NW>& ab) {
+            if constexpr (QK > 1) {
+                using dot = quantized_dot<qwide::size()>;
+                std::array<std::array<typename dot::reg, NW>, MR> acc;
+                for (auto& row : acc) {
+                    row.fill(dot::zero());
+                }
+
+                for (int g = 0; g < K / QK; g++) {
+                    std::array<typename dot::reg, NW> wb;
+                    for (int w = 0; w < NW; w++) {
+                        wb[w] = dot::load(b + (g * QTILE_WIDTH + w * qwide::size()) * QK);
+                    }
+                    for (int r = 0; r < MR; r++) {
+                        std::uint32_t wa;
+                        std::memcpy(&wa, a + (g * MR + r) * QK, sizeof(wa));
+                        for (int w = 0; w < NW; w++) {
+                            acc[r][w] = dot::add(acc[r][w], wa, wb[w]);
+                        }
+                    }
+                }
+
+                for (int r = 0; r < MR; r++) {
+                    for (int w = 0; w < NW; w++) {
+                        ab[r][w] = qwide{acc[r][w]};
+                    }
+                }
+            } else {
+                for (auto& row : ab) {
+                    row.fill(qwide{0});
+                }
+
+                for (int k = 0; k < K; k++) {
+                    std::array<qwide, NW> wb;
+                    for (int w = 0; w < NW; w++) {
+                        wb[w] = eve::convert(qwide_s8{b + k * QTILE_WIDTH + w * qwide::size()}, eve::as<std::int32_t>{});
+                    }
+                    for (int r = 0; r < MR; r++) {
+                        const qwide wa{static_cast<std::int32_t>(a[k * MR + r])};
+                        for (int w = 0; w < NW; w++) {
+                            ab[r][w] += wa * wb[w];
+                        }
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Computes a tile of `MR` rows and `cols` columns (at most `NW` registers) of a `float` or 8-bit `C` over
+         * a K longer than `quantized_max_K`: the 32-bit sums of its parts of `quantized_max_K` elements cannot overflow,
+         * and they are accumulated in single precision.
+         */
+        template<typename Out, int MR, int NW>
+        void compute_long_quantized_tile(const int K, const std::uint8_t* a, const std::int8_t* b, const int cols, const int i, const int j,
+          const quantized_output<Out>& out) {
+            tile<float, MR, NW> sums;
+            for (auto& row : sums) {
+                row.fill(eve::wide<float>{0.0f});
+            }
+
+            for (int k = 0; k < K; k += quantized_max_K) {
+                tile<std::int32_t, MR, NW> ab;
+                quantized_microkernel<MR, NW>(std::min(K - k, quantized_max_K), a + k * MR, b + k * QTILE_WIDTH, ab);
+                for (int r = 0; r < MR; r++) {
+                    for (int w = 0; w < NW; w++) {
+                        sums[r][w] += eve::convert(ab[r][w], eve::as<float>{});
+                    }
+                }
+            }
+
+            for (int w = 0; w < NW; w++) {
+                const int lanes = std::min<int>(cols - w * qwide::size(), qwide::size());
+                for (int r = 0; r < MR; r++) {
+                    out.store(i + r, j + w * qwide::size(), sums[r][w], lanes);
+                }
+            }
+        }
+
+        /**
+         * @brief Computes a tile of `MR` rows and `cols` columns (at most `NW` registers) of the sums for one K block,
+         * the tile starting at the element (i, j) of `C`.
+         *
+         * The sums of the previous K blocks are read from the accumulators unless it is the first block, and the tile
+         * goes through the output epilogue for the last one, or is written to the accumulators otherwise.
+         */
+        template<typename Out, int MR, int NW>
+        void compute_quantized_tile(const int K, const std::uint8_t* a, const std::int8_t* b, const int cols, const bool first_K, const bool last_K,
+          const int i, const int j, const quantized_output<Out>& out) {
+            // the single K block of a float or 8-bit C
+            if constexpr (!std::is_same_v<Out, std::int32_t>) {
+                if (K > quantized_max_K) {
+                    compute_long_quantized_tile<Out, MR, NW>(K, a, b, cols, i, j, out);
+                    return;
+                }
+            }
+
+            tile<std::int32_t, MR, NW> ab;
+            quantized_microkernel<MR, NW>(K, a, b, ab);
+
+            for (int w = 0; w < NW; w++) {
+                const int lanes = std::min<int>(cols - w * qwide::size(), qwide::size());
+                const auto keep = eve::ignore_last(qwide::size() - lanes);
+                for (int r = 0; r < MR; r++) {
+                    const int col = j + w * qwide::size();
+                    qwide sums = ab[r][w];
+                    if (!first_K) {
+                        sums += eve::load[keep](out.acc + (i + r) * out.ld_acc + col);
+                    }
+
+                    if (last_K) {
+                        out.store(i + r, col, sums, lanes);
+                    } else {
+                        eve::store[keep](sums, out.acc + (i + r) * out.ld_acc + col);
+                    }
+                }
+            }
+        }
+
+        template<typename Out>
+        using quantized_tile_function = void (*)(int, const std::uint8_t*, const std::int8_t*, int, bool, bool, int, int, const quantized_output<Out>&);
+
+        template<typename Out, int MR>
+        constexpr auto quantized_tiles_row = []<int... W>(std::integer_sequence<int, W...>) {
+            return std::array<quantized_tile_function<Out>, sizeof...(W)>{&compute_quantized_tile<Out, MR, W + 1>...};
+        }(std::make_integer_sequence<int, QTILE_WIDES>{});
+
+        /**
+         * @brief Table of the quantized tiles: `quantized_tiles<Out>[rows - 1][wides - 1]` computes a tile of `rows` rows
+         * and `wides` registers, the full tile being the last entry.
+         */
+        template<typename Out>
+        constexpr auto quantized_tiles = []<int... R>(std::integer_sequence<int, R...>) {
+            return std::array{quantized_tiles_row<Out, R + 1>...};
+        }(std::make_integer_sequence<int, QTILE_HEIGHT>{});
+
+        /**
+         * @brief Number of bytes of the buffers of the quantized multiplication, rounded up to whole 32-bit elements.
+         */
+        constexpr std::size_t quantized_elements(const std::size_t bytes) {
+            return (bytes + sizeof(std::int32_t) - 1) / sizeof(std::int32_t);
+        }
+
+        /**
+         * @brief Number of 32-bit elements of the workspace of the quantized multiplication: the sums of the rows of
+         * `op(A)` and of the columns of `op(B)`, one packed `BM x BK` block of `A` per thread and the packed `BK x NC`
+         * panel of `B`, with the block sizes of `quantized_sizes`.
+         */
+        inline std::size_t quantized_workspace_size(const int M, const int N, const int K, const int nb_threads, const bool int32_C) {
+            const blocking sizes = quantized_sizes(K, int32_C);
+            const std::size_t sums = static_cast<std::size_t>(M) + N;
+            const std::size_t blocks_A = nb_threads * quantized_elements(block_workspace_size(sizes));
+            const std::size_t panel_B = quantized_elements(static_cast<std::size_t>(sizes.BK) * panel_width<std::int8_t>(sizes, N));
+            return sums + blocks_A + panel_B;
+        }
+
+        /**
+         * @brief Packs the `rows x cols` block of `op(X)` as micro-panels of `width` rows (the rows of `A`, or the columns
+         * of `B` given as `op(B)^T`), the columns being interleaved by groups of `QK`: the group `g` of the row `r` of a
+         * panel is made of the `QK` bytes starting at `(g * width + r) * QK`. The columns are padded with zeros to
+         * `quantized_length(cols)`, and the last panel is padded with zero rows if `padded`, or has the remaining rows
+         * otherwise.
+         */
+        template<typename S>
+        void pack_quantized_panels(const operand<S>& X, const int rows, const int cols, const int width, const bool padded, S* dst) {
+            const int length = quantized_length(cols);
+            for (int p0 = 0; p0 < rows; p0 += width) {
+                const int panel_rows = std::min(width, rows - p0);
+                const int panel_width = padded ? width : panel_rows;
+                S* panel = dst + static_cast<std::size_t>(p0) * length;
+                for (int k = 0; k < length; k++) {
+                    S* group = panel + (k / QK) * panel_width * QK + k % QK;
+                    for (int r = 0; r < panel_width; r++) {
+                        group[r * QK] = r < panel_rows && k < cols ? *X.at(p0 + r, k) : S{0};
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Sums of the `cols` elements of each of the `rows` rows of `op(src)`.
+         */
+        template<typename S>
+        void sum_rows(const operand<S>& src, const int rows, const int cols, std::int32_t* sums) {
+            std::fill_n(sums, rows, 0);
+            for (int i = 0; i < rows; i++) {
+                for (int k = 0; k < cols; k++) {
+                    sums[i] += *src.at(i, k);
+                }
+            }
+        }
+
+        /**
+         * @brief Quantized multiplication `C = out(op(A)op(B))` of an unsigned 8-bit `A` and a signed 8-bit `B`.
+         *
+         * The loops are the ones of the floating point `gemm`: each `BK x NC` panel of `B` is packed once as micro-panels
+         * of 8-bit integers shared by the threads, and the tasks (row block, column chunk) pack their block of `A` and
+         * compute its tiles with `quantized_tiles`, the K of both being interleaved for the microkernel (see
+         * `pack_quantized_panels`). `work` holds `quantized_workspace_size(M, N, K, nb_threads, ...)` elements.
+         */
+        template<typename Out>
+        void gemm_quantized(const int M, const int N, const int K, const operand<std::uint8_t> A, const operand<std::int8_t> B, Out* C, const int ldc,
+          const quantization& params, const int nb_threads, std::int32_t* work) {
+            const blocking sizes = quantized_sizes(K, std::is_same_v<Out, std::int32_t>);
+            const int BM = sizes.BM;
+            const int BN = sizes.BN;
+            const int BK = sizes.BK;
+            const int NC = panel_width<std::int8_t>(sizes, N);
+
+            std::int32_t* rows_A = work;
+            std::int32_t* cols_B = rows_A + M;
+            std::int32_t* buffers = cols_B + N;
+            if (params.zero_point_B != 0) {
+                sum_rows(A, M, K, rows_A);
+            }
+            if (params.zero_point_A != 0) {
+                sum_rows(operand<std::int8_t>{B.data, B.ld, !B.transposed}, N, K, cols_B);
+            }
+
+            // a 32-bit C holds the partial sums itself, the other ones have a single K block
+            quantized_output<Out> out{C, ldc, nullptr, ldc, rows_A, cols_B, params, K};
+            if constexpr (std::is_same_v<Out, std::int32_t>) {
+                out.acc = C;
+            }
+            const auto work_A = [=](const int thread_id) {
+                return reinterpret_cast<std::uint8_t*>(buffers) + thread_id * quantized_elements(block_workspace_size(sizes)) * sizeof(std::int32_t);
+            };
+            auto* panel_B = reinterpret_cast<std::int8_t*>(buffers + nb_threads * quantized_elements(block_workspace_size(sizes)));
+
+            if (K == 0) {
+                for (int i = 0; i < M; i++) {
+                    for (int j = 0; j < N; j += qwide::size()) {
+                        out.store(i, j, qwide{0}, std::min<int>(N - j, qwide::size()));
+                    }
+                }
+                return;
+            }
+
+            const int blocks_M = (M + BM - 1) / BM;
+            const int wanted_tasks = nb_threads > 1 ? 2 * nb_threads : 1;
+
+            for (int jc = 0; jc < N; jc += NC) {
+                const int panel_N = std::min(N - jc, NC);
+
+                // task decomposition
+                const int blocks_N = (panel_N + BN - 1) / BN;
+                const int chunks_N = std::min(blocks_N, (wanted_tasks + blocks_M - 1) / blocks_M);
+                const int chunk_width = ((blocks_N + chunks_N - 1) / chunks_N) * BN;
+
+                for (int k = 0; k < K; k += BK) {
+                    const int real_K = std::min(K - k, BK);
+                    const int length = quantized_length(real_K);
+                    const bool first_K = k == 0;
+                    const bool last_K = k + BK >= K;
+
+                    // the blocks are made of whole micro-panels, so the packed panel is a sequence of micro-panels
+                    parallel_for(blocks_N, nb_threads, [=](const int bj, int) {
+                        const int j = bj * BN;
+                        const operand<std::int8_t> block_B{B.at(k, jc + j), B.ld, !B.transposed};
+                        pack_quantized_panels(block_B, std::min(panel_N - j, BN), real_K, QTILE_WIDTH, true, panel_B + static_cast<std::size_t>(j) * length);
+                    });
+
+                    parallel_for(blocks_M * chunks_N, nb_threads, [=, &out](const int task, const int thread_id) {
+                        const int i = (task / chunks_N) * BM;
+                        const int j = (task % chunks_N) * chunk_width;
+                        const int real_M = std::min(M - i, BM);
+                        const int real_N = std::min(panel_N - j, chunk_width);
+                        if (real_N <= 0) {
+                            return;
+                        }
+
+                        std::uint8_t* packed_A = work_A(thread_id);
+                        pack_quantized_panels(A.from(i, k), real_M, real_K, QTILE_HEIGHT, false, packed_A);
+
+                        for (int tj = 0; tj < real_N; tj += QTILE_WIDTH) {
+                            const int cols = std::min(real_N - tj, QTILE_WIDTH);
+                            const int wides = (cols + qwide::size() - 1) / qwide::size();
+                            const std::int8_t* b = panel_B + static_cast<std::size_t>(j + tj) * length;
+                            for (int ti = 0; ti < real_M; ti += QTILE_HEIGHT) {
+                                const int rows = std::min(real_M - ti, QTILE_HEIGHT);
+                                quantized_tiles<Out>[rows - 1][wides - 1](
+                                  length, packed_A + ti * length, b, cols, first_K, last_K, i + ti, jc + j + tj, out);
+                            }
+                        }
+                    });
+                }
+            }
+        }
+    } // namespace detail
+
+    /**
+     * @brief Returns the number of 32-bit elements of the workspace needed by the quantized multiplication of a
+     * `M x K` matrix by a `K x N` matrix using at most `nb_threads` threads, `C` being of type `Out`.
+     */
+    template<typename Out>
+    std::size_t quantized_workspace_size(const int M, const int N, const int K, const int nb_threads = get_num_threads()) {
+        return detail::quantized_workspace_size(M, N, K, std::clamp(nb_threads, 1, detail::max_threads()), std::is_same_v<Out, std::int32_t>);
+    }
+
+    /**
+     * @brief Performs the quantized multiplication `C = op(A)op(B)` of an unsigned 8-bit matrix `A` by a signed 8-bit
+     * matrix `B` (`u8 x s8`), using at most `nb_threads` threads and the buffers of `ws`.
+     *
+     * The products are accumulated on 32 bits, the zero points of `params` being subtracted from the operands. `C`
+     * receives the 32-bit sums (`std::int32_t`), the sums multiplied by the scales (`float`), or the sums requantized
+     * to unsigned 8-bit integers (`std::uint8_t`): scaled, rounded to the nearest integer, shifted by `zero_point_C`
+     * and saturated. `C` is overwritten. The other parameters are the ones of the floating point `gemm`.
+     *
+     * The 32-bit sums limit `K` to 65536 for a 32-bit `C`. The sums of a `float` or 8-bit `C` over a longer K are
+     * accumulated in single precision by parts of 65536 elements, `K` being at most 8421504 (the 32-bit sums of the
+     * rows of `op(A)`). A larger `K` throws `std::length_error`.
+     */
+    template<typename Out>
+        requires std::is_same_v<Out, std::int32_t> || std::is_same_v<Out, float> || std::is_same_v<Out, std::uint8_t>
+    void gemm(transposition transA, transposition transB, const int M, const int N, const int K, const std::uint8_t* A, const int lda,
+      const std::int8_t* B, const int ldb, Out* C, const int ldc, const quantization& params, const int nb_threads, workspace<std::int32_t>& ws) {
+        if (K > detail::quantized_K_limit<Out>) {
+            throw std::length_error("gemm: K is too large for the 32-bit sums of the quantized multiplication");
+        }
+        const int threads = std::clamp(nb_threads, 1, detail::max_threads());
+        ws.reserve(quantized_workspace_size<Out>(M, N, K, threads));
+        const detail::operand<std::uint8_t> op_A{A, lda, transA != transposition::none};
+        const detail::operand<std::int8_t> op_B{B, ldb, transB != transposition::none};
+        detail::gemm_quantized(M, N, K, op_A, op_B, C, ldc, params, threads, ws.data());
+    }
+
+    /**
+     * @brief Performs the quantized multiplication `C = op(A)op(B)` using at most `nb_threads` threads and the
+     * workspace of the calling thread.
+     */
+    template<typename Out>
+        requires std::is_same_v<Out, std::int32_t> || std::is_same_v<Out, float> || std::is_same_v<Out, std::uint8_t>
+    void gemm(transposition transA, transposition transB, const int M, const int N, const int K, const std::uint8_t* A, const int lda,
+      const std::int8_t* B, const int ldb, Out* C, const int ldc, const quantization& params, const int nb_threads) {
+        gemm(transA, transB, M, N, K, A, lda, B, ldb, C, ldc, params, nb_threads, detail::default_workspace<std::int32_t>());
+    }
+
+    /**
+     * @brief Performs the quantized multiplication `C = op(A)op(B)` using the process wide number of threads.
+     */
+    template<typename Out>
+        requires std::is_same_v<Out, std::int32_t> || std::is_same_v<Out, float> || std::is_same_v<Out, std::uint8_t>
+    void gemm(transposition transA, transposition transB, const int M, const int N, const int K, const std::uint8_t* A, const int lda,
+      const std::int8_t* B, const int ldb, Out* C, const int ldc, const quantization& params = {}) {
+        gemm(transA, transB, M, N, K, A, lda, B, ldb, C, ldc, params, get_num_threads());
+    }
+} // namespace gemm
+
+#endif
@@ -0,0 +1,264 @@
+#ifndef GEMM_STRASSEN_HPP
+#define GEMM_STRASSEN_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+
+#include "gemm/gemm.hpp"
+
+namespace gemm
+{
+    /**
+     * @brief Parameters of the Strassen-Winograd multiplication.
+     */
+    struct strassen_options {
+        int crossover = 2048; // the products whose smallest dimension is lower are made by the blocked multiplication
+        int max_levels = 3;   // maximum number of recursion levels
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Tells if a product of the recursion level `level` is made by the regular multiplication.
+         */
+        constexpr bool is_strassen_leaf(const int M, const int N, const int K, const int level, const strassen_options& options) {
+            return level >= options.max_levels || std::min({M, N, K}) < std::max(options.crossover, 2);
+        }
+
+        /**
+         * @brief Number of elements of the workspace of `strassen_accumulate` at the recursion level `level`.
+         *
+         * A level uses a `m x k` sum of quarters of `A`, a `k x n` sum of quarters of `B` and a `m x n` product, `m`,
+         * `n` and `k` being the halves of the even parts of the dimensions. They are followed by the workspace of the
+         * next level, which is also used by the products of the rows and columns left by odd dimensions.
+         */
+        template<typename T>
+        std::size_t strassen_level_size(const int M, const int N, const int K, const int level, const int nb_threads, const strassen_options& options) {
+            if (is_strassen_leaf(M, N, K, level, options)) {
+                return workspace_size<T>(M, N, K, nb_threads);
+            }
+
+            const int m = M / 2;
+            const int n = N / 2;
+            const int k = K / 2;
+            const std::size_t temporaries = static_cast<std::size_t>(m) * k + static_cast<std::size_t>(k) * n + static_cast<std::size_t>(m) * n;
+            const std::size_t fringes = std::max({workspace_size<T>(1, N, K, nb_threads), workspace_size<T>(2 * m, 1, K, nb_threads),
+              workspace_size<T>(2 * m, 2 * n, 1, nb_threads)});
+            return temporaries + std::max(strassen_level_size<T>(m, n, k, level + 1, nb_threads, options), fringes);
+        }
+
+        /**
+         * @brief Computes `dst = op(X) + sign * op(Y)`, `dst` being a row major `rows x cols` matrix. `X` may be `dst`
+         * itself.
+         */
+        template<typename T>
+        void combine(const int rows, const int cols, const operand<T> X, const T sign, const operand<T> Y, T* dst, const int nb_threads) {
+            parallel_for(rows, nb_threads, [=](const int i, int) {
+                T* d = dst + static_cast<std::size_t>(i) * cols;
+                if (!X.transposed && !Y.transposed) {
+                    const T* x = X.at(i, 0);
+                    const T* y = Y.at(i, 0);
+                    for (int j = 0; j < cols; j++) {
+                        d[j] = x[j] + sign * y[j];
+                    }
+                } else {
+                    for (int j = 0; j < cols; j++) {
+                        d[j] = *X.at(i, j) + sign * *Y.at(i, j);
+                    }
+                }
+            });
+        }
+
+        /**
+         * @brief Adds the row major `rows x cols` matrix `Z` to each of the matrices `dsts`, which have `ld` elements
+         * between two rows.
+         */
+        template<typename T>
+        void add_to(const int rows, const int cols, const T* Z, std::initializer_list<T*> dsts, const int ld, const int nb_threads) {
+            parallel_for(rows, nb_threads, [=](const int i, int) {
+                const T* z = Z + static_cast<std::size_t>(i) * cols;
+                for (T* dst : dsts) {
+                    T* d = dst + static_cast<std::size_t>(i) * ld;
+                    for (int j = 0; j < cols; j++) {
+                        d[j] += z[j];
+                    }
+                }
+            });
+        }
+
+        /**
+         * @brief Computes `C += alpha * op(A)op(B)` with the regular multiplication.
+         */
+        template<typename T>
+        void accumulate_product(const int M, const int N, const int K, const T alpha, const operand<T> A, const operand<T> B, T* C, const int ldc,
+          const int nb_threads, T* work) {
+            multiply(A.transposed, B.transposed, M, N, K, alpha, A.data, A.ld, B.data, B.ld, T{1}, C, ldc, nb_threads, work);
+        }
+
+        /**
+         * @brief Computes `C += alpha * op(A)op(B)` with the Strassen-Winograd algorithm, `work` holding
+         * `strassen_level_size<T>(M, N, K, level, nb_threads, options)` elements.
+         *
+         * With the quarters `A11`... of `op(A)` and `B11`... of `op(B)`, and `S1 = A21 + A22`, `S2 = S1 - A11`,
+         * `S3 = A11 - A21`, `S4 = A12 - S2`, `T1 = B12 - B11`, `T2 = B22 - T1`, `T3 = B22 - B12`, `T4 = T2 - B21`, the
+         * seven products are `P1 = A11 B11`, `P2 = A12 B21`, `P3 = S4 B22`, `P4 = A22 T4`, `P5 = S1 T1`, `P6 = S2 T2`
+         * and `P7 = S3 T3`, and `C11 += P1 + P2`, `C12 += P1 + P3 + P5 + P6`, `C21 += P1 - P4 + P6 + P7`,
+         * `C22 += P1 + P5 + P6 + P7`. The products which go to a single quarter are accumulated into it, the other
+         * ones are computed in a temporary and added to their quarters, so a level only needs one temporary of each
+         * shape. The last row, column or K index of odd dimensions are added by regular multiplications.
+         */
+        template<typename T>
+        void strassen_accumulate(const int M, const int N, const int K, const T alpha, const operand<T> A, const operand<T> B, T* C, const int ldc,
+          const int level, const int nb_threads, const strassen_options& options, T* work) {
+            if (is_strassen_leaf(M, N, K, level, options)) {
+                accumulate_product(M, N, K, alpha, A, B, C, ldc, nb_threads, work);
+                return;
+            }
+
+            const int m = M / 2;
+            const int n = N / 2;
+            const int k = K / 2;
+            T* X = work;
+            T* Y = X + static_cast<std::size_t>(m) * k;
+            T* Z = Y + static_cast<std::size_t>(k) * n;
+            T* next = Z + static_cast<std::size_t>(m) * n;
+
+            const operand<T> A11 = A.from(0, 0);
+            const operand<T> A12 = A.from(0, k);
+            const operand<T> A21 = A.from(m, 0);
+            const operand<T> A22 = A.from(m, k);
+            const operand<T> B11 = B.from(0, 0);
+            const operand<T> B12 = B.from(0, n);
+            const operand<T> B21 = B.from(k, 0);
+            const operand<T> B22 = B.from(k, n);
+            T* C11 = C;
+            T* C12 = C + n;
+            T* C21 = C + static_cast<std::size_t>(m) * ldc;
+            T* C22 = C21 + n;
+            const operand<T> op_X{X, k, false};
+            const operand<T> op_Y{Y, n, false};
+
+            const auto product = [&](const T scale, const operand<T> a, const operand<T> b, T* c, const int ld) {
+                strassen_accumulate(m, n, k, scale, a, b, c, ld, level + 1, nb_threads, options, next);
+            };
+            const auto product_to_Z = [&](const operand<T> a, const operand<T> b) {
+                std::fill_n(Z, static_cast<std::size_t>(m) * n, T{0});
+                product(alpha, a, b, Z, n);
+            };
+
+            // P1 goes to the four quarters, P2 to C11
+            product_to_Z(A11, B11);
+            add_to(m, n, Z, {C11, C12, C21, C22}, ldc, nb_threads);
+            product(alpha, A12, B21, C11, ldc);
+
+            // P5 = S1 T1 goes to C12 and C22
+            combine(m, k, A21, T{1}, A22, X, nb_threads);
+            combine(k, n, B12, T{-1}, B11, Y, nb_threads);
+            product_to_Z(op_X, op_Y);
+            add_to(m, n, Z, {C12, C22}, ldc, nb_threads);
+
+            // P6 = S2 T2 goes to C12, C21 and C22
+            combine(m, k, op_X, T{-1}, A11, X, nb_threads);
+            combine(k, n, B22, T{-1}, op_Y, Y, nb_threads);
+            product_to_Z(op_X, op_Y);
+            add_to(m, n, Z, {C12, C21, C22}, ldc, nb_threads);
+
+            // P3 = S4 B22 goes to C12, P4 = A22 T4 is subtracted from C21
+            combine(m, k, A12, T{-1}, op_X, X, nb_threads);
+            product(alpha, op_X, B22, C12, ldc);
+            combine(k, n, op_Y, T{-1}, B21, Y, nb_threads);
+            product(-alpha, A22, op_Y, C21, ldc);
+
+            // P7 = S3 T3 goes to C21 and C22
+            combine(m, k, A11, T{-1}, A21, X, nb_threads);
+            combine(k, n, B22, T{-1}, B12, Y, nb_threads);
+            product_to_Z(op_X, op_Y);
+            add_to(m, n, Z, {C21, C22}, ldc, nb_threads);
+
+            // odd dimensions: the last K index, then the last row and column of C
+            const int even_M = 2 * m;
+            const int even_N = 2 * n;
+            if (K % 2 != 0) {
+                accumulate_product(even_M, even_N, 1, alpha, A.from(0, K - 1), B.from(K - 1, 0), C, ldc, nb_threads, next);
+            }
+            if (M % 2 != 0) {
+                accumulate_product(1, N, K, alpha, A.from(M - 1, 0), B, C + static_cast<std::size_t>(M - 1) * ldc, ldc, nb_threads, next);
+            }
+            if (N % 2 != 0) {
+                accumulate_product(even_M, 1, K, alpha, A, B.from(0, N - 1), C + (N - 1), ldc, nb_threads, next);
+            }
+        }
+    } // namespace detail
+
+    /**
+     * @brief Returns the number of elements of the workspace needed by `gemm_strassen` to multiply a `M x K` matrix
+     * by a `K x N` matrix using at most `nb_threads` threads.
+     */
+    template<typename T>
+    std::size_t strassen_workspace_size(const int M, const int N, const int K, const int nb_threads = get_num_threads(), const strassen_options& options = {}) {
+        return detail::strassen_level_size<T>(M, N, K, 0, std::clamp(nb_threads, 1, detail::max_threads()), options);
+    }
+
+    /**
+     * @brief Performs the operation `C = alpha * op(A)op(B)  + beta * C` with the Strassen-Winograd algorithm, using at
+     * most `nb_threads` threads and the buffers of `ws` (which is grown if it is smaller than
+     * `strassen_workspace_size<T>(M, N, K, nb_threads, options)`).
+     *
+     * The products are split in seven products of half dimensions instead of eight, recursively while the dimensions
+     * are at least `options.crossover`, for at most `options.max_levels` levels, the remaining products being made by
+     * the regular multiplication. A level saves an eighth of the flops for about `n^2` additions, which pays off for
+     * large matrices. The error bound is weaker than the one of the regular multiplication: it grows with the number
+     * of levels and is normwise rather than elementwise, so the elements of `C` much smaller than the others may have
+     * a larger relative error. The temporaries of all the levels are taken from the workspace, so no memory is
+     * allocated during the recursion. The other parameters are the ones of `gemm`.
+     */
+    template<typename T>
+    void gemm_strassen(transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const T* A, const int lda,
+      const T* B, const int ldb, const T beta, T* C, const int ldc, const int nb_threads, workspace<T>& ws, const strassen_options& options = {}) {
+        const bool transposed_A = transA != transposition::none;
+        const bool transposed_B = transB != transposition::none;
+        const int threads = std::clamp(nb_threads, 1, detail::max_threads());
+        ws.reserve(strassen_workspace_size<T>(M, N, K, threads, options));
+
+        if (detail::is_strassen_leaf(M, N, K, 0, options)) {
+            detail::multiply(transposed_A, transposed_B, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, threads, ws.data());
+            return;
+        }
+
+        // the recursion accumulates the products, C is scaled first (and not read if beta is 0)
+        if (beta != T{1}) {
+            detail::parallel_for(M, threads, [=](const int i, int) {
+                T* c = C + static_cast<std::size_t>(i) * ldc;
+                for (int j = 0; j < N; j++) {
+                    c[j] = beta == T{0} ? T{0} : beta * c[j];
+                }
+            });
+        }
+        const detail::operand<T> op_A{A, lda, transposed_A};
+        const detail::operand<T> op_B{B, ldb, transposed_B};
+        detail::strassen_accumulate(M, N, K, alpha, op_A, op_B, C, ldc, 0, threads, options, ws.data());
+    }
+
+    /**
+     * @brief Performs the operation `C = alpha * op(A)op(B)  + beta * C` with the Strassen-Winograd algorithm, using at
+     * most `nb_threads` threads and the workspace of the calling thread.
+     */
+    template<typename T>
+    void gemm_strassen(transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const T* A, const int lda,
+      const T* B, const int ldb, const T beta, T* C, const int ldc, const int nb_threads, const strassen_options& options = {}) {
+        gemm_strassen<T>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads, detail::default_workspace<T>(), options);
+    }
+
+    /**
+     * @brief Performs the operation `C = alpha * op(A)op(B)  + beta * C` with the Strassen-Winograd algorithm, using the
+     * process wide number of threads.
+     */
+    template<typename T>
+    void gemm_strassen(transposition transA, transposition transB, const int M, const int N, const int K, const T alpha, const T* A, const int lda,
+      const T* B, const int ldb, const T beta, T* C, const int ldc) {
+        gemm_strassen<T>(transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, get_num_threads());
+    }
+} // namespace gemm
+
+#endif
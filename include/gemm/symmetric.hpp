@@ -0,0 +1,409 @@
+#ifndef GEMM_SYMMETRIC_HPP
+#define GEMM_SYMMETRIC_HPP
+
+#include <eve/eve.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+
+#include "gemm/detail/update.hpp"
+#include "gemm/gemm.hpp"
+
+namespace gemm
+{
+    namespace detail
+    {
+        /**
+         * @brief A symmetric matrix of which only one triangle is stored (row major, `ld` elements between two rows),
+         * seen from its element (row, col): the elements of the other triangle are read at their mirrored position.
+         */
+        template<typename T>
+        struct symmetric_operand {
+            const T* data;
+            int ld;
+            bool lower;
+            int row = 0;
+            int col = 0;
+
+            /**
+             * @brief Address of the element (i, j), relative to (row, col), in the stored triangle.
+             */
+            const T* at(const int i, const int j) const {
+                const int r = row + i;
+                const int c = col + j;
+                const bool stored = lower ? r >= c : r <= c;
+                return stored ? data + r * ld + c : data + c * ld + r;
+            }
+
+            /**
+             * @brief The matrix made of the rows and columns starting from (i, j).
+             */
+            symmetric_operand from(const int i, const int j) const {
+                return {data, ld, lower, row + i, col + j};
+            }
+        };
+
+        /**
+         * @brief Packs the `rows x cols` block of a symmetric matrix starting at its first element in `work_A`, as
+         * micro-panels of `MR` rows (see `pack_A_panels`), reading the elements of the other triangle by symmetry.
+         */
+        template<typename T>
+        void pack_block_A(const symmetric_operand<T>& A, const int rows, const int cols, const int MR, T* work_A) {
+            for (int i0 = 0; i0 < rows; i0 += MR) {
+                const int panel_rows = std::min(MR, rows - i0);
+                T* panel = work_A + i0 * cols;
+                for (int k = 0; k < cols; k++) {
+                    for (int r = 0; r < panel_rows; r++) {
+                        panel[k * panel_rows + r] = *A.at(i0 + r, k);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Packs the `rows x cols` block of a symmetric matrix starting at (k, j) in `work_B`, as micro-panels of
+         * `TILE_WIDTH` columns (see `pack_B_panels`), reading the elements of the other triangle by symmetry.
+         */
+        template<typename T>
+        void pack_block_B(const symmetric_operand<T>& B, const int k, const int j, const int rows, const int cols, T* work_B) {
+            constexpr int NR = TILE_WIDTH<T>;
+            for (int j0 = 0; j0 < cols; j0 += NR) {
+                const int panel_cols = std::min(NR, cols - j0);
+                T* panel = work_B + j0 * rows;
+                for (int r = 0; r < rows; r++) {
+                    for (int c = 0; c < panel_cols; c++) {
+                        panel[r * NR + c] = *B.at(k + r, j + j0 + c);
+                    }
+                    std::memset(panel + r * NR + panel_cols, 0, (NR - panel_cols) * sizeof(T));
+                }
+            }
+        }
+
+        /**
+         * @brief Multiplies a block of `M` rows and `K` columns of `op(A)` by the packed blocks of `op(A)^T` covering `N`
+         * columns as `gemm_block` does, but only computes the tiles of `C` which intersect its `lower` (or upper)
+         * triangle, the element (0, 0) of the block being at `diagonal` columns from the diagonal.
+         *
+         * The tiles crossing the diagonal are computed in a buffer, then only the elements of the triangle are added to
+         * `C`; the other tiles are skipped.
+         */
+        template<typename T, int TILE_HEIGHT, typename BlockB>
+        void syrk_block(const bool lower, const int diagonal, const int M, const int N, const int K, const T alpha, const operand<T>& A,
+          const BlockB& block_B, const T beta, const bool first_K, T* C, const int ldc, const blocking& sizes, T* work_A) {
+            const int BN = sizes.BN;
+            constexpr auto TILE_WIDES = gemm::detail::TILE_WIDES<T>;
+            constexpr auto TILE_WIDTH = gemm::detail::TILE_WIDTH<T>;
+            constexpr int wide_size = eve::wide<T>::size();
+
+            pack_block_A(A, M, K, TILE_HEIGHT, work_A);
+
+            for (int bj = 0; bj < N; bj += BN) {
+                const int real_N = std::min(N - bj, BN);
+                const T* packed_B = block_B(bj);
+
+                for (int ti = 0; ti < M; ti += TILE_HEIGHT) {
+                    const int rows = std::min(M - ti, TILE_HEIGHT);
+                    const T* panel_A = work_A + ti * K;
+                    for (int tj = 0; tj < real_N; tj += TILE_WIDTH) {
+                        const int cols = std::min(real_N - tj, TILE_WIDTH);
+                        T* c = C + ti * ldc + (bj + tj);
+
+                        // the element (r, x) of the tile is at `first + x - r` columns from the diagonal
+                        const int first = diagonal + bj + tj - ti;
+                        const int lowest = first - (rows - 1);
+                        const int highest = first + cols - 1;
+                        if (lower ? lowest > 0 : highest < 0) {
+                            continue;
+                        }
+
+                        const int wides = (cols + wide_size - 1) / wide_size;
+                        if (lower ? highest <= 0 : lowest >= 0) {
+                            if (rows == TILE_HEIGHT && cols == TILE_WIDTH) {
+                                compute_tile<T, TILE_HEIGHT, TILE_WIDES>(K, panel_A, packed_B + tj * K, cols, alpha, beta, first_K, c, ldc);
+                            } else {
+                                fringe_tiles<T, TILE_HEIGHT>[rows - 1][wides - 1](K, panel_A, packed_B + tj * K, cols, alpha, beta, first_K, c, ldc);
+                            }
+                            continue;
+                        }
+
+                        // the tile crosses the diagonal
+                        std::array<T, TILE_HEIGHT * TILE_WIDTH> ab;
+                        fringe_tiles<T, TILE_HEIGHT>[rows - 1][wides - 1](K, panel_A, packed_B + tj * K, cols, T{1}, T{0}, true, ab.data(), TILE_WIDTH);
+                        for (int r = 0; r < rows; r++) {
+                            for (int x = 0; x < cols; x++) {
+                                const int distance = first + x - r;
+                                if (lower ? distance <= 0 : distance >= 0) {
+                                    update(alpha, ab[r * TILE_WIDTH + x], first_K ? beta : T{1}, c + r * ldc + x);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Symmetric rank-k update: computes the `lower` (or upper) triangle of `C = alpha * op(A)op(A)^T + beta * C`,
+         * `op(A)` being a `N x K` operand, the other triangle of `C` being neither read nor written.
+         *
+         * The loops and the tasks are the ones of `gemm`, `op(A)^T` being packed as `op(B)` from the same storage, but
+         * the tasks and tiles outside the triangle are skipped, which halves the flops. `work` holds
+         * `blocked_workspace_size<T>(sizes, N, nb_threads)` elements.
+         */
+        template<typename T>
+        void syrk(const bool lower, const int N, const int K, const T alpha, const operand<T> A, const T beta, T* C, const int ldc, const blocking& sizes,
+          const int nb_threads, T* work) {
+            const int BM = sizes.BM;
+            const int BN = sizes.BN;
+            const int BK = sizes.BK;
+
+            if (K == 0) {
+                for (int i = 0; i < N; i++) {
+                    const int first = lower ? 0 : i;
+                    const int last = lower ? i + 1 : N;
+                    for (int j = first; j < last; j++) {
+                        C[i * ldc + j] = beta == T{0} ? T{0} : beta * C[i * ldc + j];
+                    }
+                }
+                return;
+            }
+
+            const operand<T> B{A.data, A.ld, !A.transposed};
+            const int NC = panel_width<T>(sizes, N);
+            const std::size_t block_B_size = static_cast<std::size_t>(BK) * BN;
+            T* panel_B = work + nb_threads * block_workspace_size(sizes);
+
+            const int blocks_M = (N + BM - 1) / BM;
+            const int wanted_tasks = nb_threads > 1 ? 2 * nb_threads : 1;
+
+            with_tile_height(sizes.tile_height, [&](auto tile_height) {
+                for (int jc = 0; jc < N; jc += NC) {
+                    const int panel_N = std::min(N - jc, NC);
+
+                    const int blocks_N = (panel_N + BN - 1) / BN;
+                    const int chunks_N = std::min(blocks_N, (wanted_tasks + blocks_M - 1) / blocks_M);
+                    const int chunk_width = ((blocks_N + chunks_N - 1) / chunks_N) * BN;
+
+                    for (int k = 0; k < K; k += BK) {
+                        const int real_K = std::min(K - k, BK);
+
+                        parallel_for(blocks_N, nb_threads, [=](const int bj, int) {
+                            const int j = bj * BN;
+                            pack_block_B(B, k, jc + j, real_K, std::min(panel_N - j, BN), panel_B + bj * block_B_size);
+                        });
+
+                        parallel_for(blocks_M * chunks_N, nb_threads, [=](const int task, const int thread_id) {
+                            const int i = (task / chunks_N) * BM;
+                            const int j = (task % chunks_N) * chunk_width;
+                            const int real_M = std::min(N - i, BM);
+                            const int col = jc + j;
+
+                            // the columns of the lower triangle end after the last row of the block, the ones of the
+                            // upper triangle start at its first row
+                            int real_N = std::min(panel_N - j, chunk_width);
+                            if (lower) {
+                                real_N = std::min(real_N, i + real_M - col);
+                            } else if (col + real_N <= i) {
+                                return;
+                            }
+                            if (real_N <= 0) {
+                                return;
+                            }
+
+                            T* work_A = work + thread_id * block_workspace_size(sizes);
+                            syrk_block<T, decltype(tile_height)::value>(lower, col - i, real_M, real_N, real_K, alpha, A.from(i, k),
+                              [=](const int bj) -> const T* { return panel_B + ((j + bj) / BN) * block_B_size; }, beta, k == 0, C + i * ldc + col,
+                              ldc, sizes, work_A);
+                        });
+                    }
+                }
+            });
+        }
+    } // namespace detail
+
+    /**
+     * @brief Returns the number of elements of the workspace needed by `syrk` and `symm` when `C` has `N` columns,
+     * using at most `nb_threads` threads.
+     */
+    template<typename T>
+    std::size_t symmetric_workspace_size(const int N, const int nb_threads = get_num_threads()) {
+        return detail::blocked_workspace_size<T>(get_blocking<T>(), N, std::clamp(nb_threads, 1, detail::max_threads()));
+    }
+
+    /**
+     * @brief Performs the symmetric rank-k update `C = alpha * op(A)op(A)^T + beta * C` on the triangle `uplo` of the
+     * `N x N` matrix `C`, using at most `nb_threads` threads and the buffers of `ws`.
+     *
+     * `op(A)` is the `N x K` matrix `A` (`trans` is `none`) or the transpose of the `K x N` matrix `A`. Only the
+     * triangle `uplo` of `C` is read and written, so the product costs half the flops of `gemm`. The other parameters
+     * are the ones of `gemm`.
+     */
+    template<typename T>
+    void syrk(triangle uplo, transposition trans, const int N, const int K, const T alpha, const T* A, const int lda, const T beta, T* C, const int ldc,
+      const int nb_threads, workspace<T>& ws) {
+        const int threads = std::clamp(nb_threads, 1, detail::max_threads());
+        ws.reserve(symmetric_workspace_size<T>(N, threads));
+        const detail::operand<T> op_A{A, lda, trans != transposition::none};
+        detail::syrk(uplo == triangle::lower, N, K, alpha, op_A, beta, C, ldc, get_blocking<T>(), threads, ws.data());
+    }
+
+    /**
+     * @brief Performs the symmetric rank-k update using at most `nb_threads` threads and the workspace of the calling
+     * thread.
+     */
+    template<typename T>
+    void syrk(triangle uplo, transposition trans, const int N, const int K, const T alpha, const T* A, const int lda, const T beta, T* C, const int ldc,
+      const int nb_threads) {
+        syrk<T>(uplo, trans, N, K, alpha, A, lda, beta, C, ldc, nb_threads, detail::default_workspace<T>());
+    }
+
+    /**
+     * @brief Performs the symmetric rank-k update using the process wide number of threads.
+     */
+    template<typename T>
+    void syrk(triangle uplo, transposition trans, const int N, const int K, const T alpha, const T* A, const int lda, const T beta, T* C, const int ldc) {
+        syrk<T>(uplo, trans, N, K, alpha, A, lda, beta, C, ldc, get_num_threads());
+    }
+
+    /**
+     * @brief Performs the operation `C = alpha * A * B + beta * C` (`sideA` is `left`) or `C = alpha * B * A + beta * C`
+     * (`sideA` is `right`), `A` being a symmetric matrix of which only the triangle `uplo` is read, using at most
+     * `nb_threads` threads and the buffers of `ws`.
+     *
+     * `C` and `B` are `M x N` matrices, and `A` is `M x M` (left) or `N x N` (right). The missing triangle of `A` is
+     * read by symmetry while `A` is packed, so the product runs as fast as `gemm`. The other parameters are the ones of
+     * `gemm`.
+     */
+    template<typename T>
+    void symm(side sideA, triangle uplo, const int M, const int N, const T alpha, const T* A, const int lda, const T* B, const int ldb, const T beta, T* C,
+      const int ldc, const int nb_threads, workspace<T>& ws) {
+        const int threads = std::clamp(nb_threads, 1, detail::max_threads());
+        ws.reserve(symmetric_workspace_size<T>(N, threads));
+        const detail::symmetric_operand<T> op_A{A, lda, uplo == triangle::lower};
+        const detail::operand<T> op_B{B, ldb, false};
+        if (sideA == side::left) {
+            detail::gemm(M, N, M, alpha, op_A, op_B, beta, C, ldc, get_blocking<T>(), threads, ws.data());
+        } else {
+            detail::gemm(M, N, N, alpha, op_B, op_A, beta, C, ldc, get_blocking<T>(), threads, ws.data());
+        }
+    }
+
+    /**
+     * @brief Performs the symmetric multiplication using at most `nb_threads` threads and the workspace of the calling
+     * thread.
+     */
+    template<typename T>
+    void symm(side sideA, triangle uplo, const int M, const int N, const T alpha, const T* A, const int lda, const T* B, const int ldb, const T beta, T* C,
+      const int ldc, const int nb_threads) {
+        symm<T>(sideA, uplo, M, N, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads, detail::default_workspace<T>());
+    }
+
+    /**
+     * @brief Performs the symmetric multiplication using the process wide number of threads.
+     */
+    template<typename T>
+    void symm(side sideA, triangle uplo, const int M, const int N, const T alpha, const T* A, const int lda, const T* B, const int ldb, const T beta, T* C,
+      const int ldc) {
+        symm<T>(sideA, uplo, M, N, alpha, A, lda, B, ldb, beta, C, ldc, get_num_threads());
+    }
+
+    /**
+     * @brief Performs simple precision symmetric rank-k update (see `syrk`).
+     */
+    inline void ssyrk(triangle uplo, transposition trans, const int N, const int K, const float alpha, const float* A, const int lda, const float beta, float* C,
+      const int ldc) {
+        syrk<float>(uplo, trans, N, K, alpha, A, lda, beta, C, ldc);
+    }
+
+    /**
+     * @brief Performs simple precision symmetric rank-k update (see `syrk`).
+     */
+    inline void ssyrk(triangle uplo, transposition trans, const int N, const int K, const float alpha, const float* A, const int lda, const float beta, float* C,
+      const int ldc, const int nb_threads) {
+        syrk<float>(uplo, trans, N, K, alpha, A, lda, beta, C, ldc, nb_threads);
+    }
+
+    /**
+     * @brief Performs simple precision symmetric rank-k update (see `syrk`).
+     */
+    inline void ssyrk(triangle uplo, transposition trans, const int N, const int K, const float alpha, const float* A, const int lda, const float beta, float* C,
+      const int ldc, const int nb_threads, workspace<float>& ws) {
+        syrk<float>(uplo, trans, N, K, alpha, A, lda, beta, C, ldc, nb_threads, ws);
+    }
+
+    /**
+     * @brief Performs double precision symmetric rank-k update (see `syrk`).
+     */
+    inline void dsyrk(triangle uplo, transposition trans, const int N, const int K, const double alpha, const double* A, const int lda, const double beta, double* C,
+      const int ldc) {
+        syrk<double>(uplo, trans, N, K, alpha, A, lda, beta, C, ldc);
+    }
+
+    /**
+     * @brief Performs double precision symmetric rank-k update (see `syrk`).
+     */
+    inline void dsyrk(triangle uplo, transposition trans, const int N, const int K, const double alpha, const double* A, const int lda, const double beta, double* C,
+      const int ldc, const int nb_threads) {
+        syrk<double>(uplo, trans, N, K, alpha, A, lda, beta, C, ldc, nb_threads);
+    }
+
+    /**
+     * @brief Performs double precision symmetric rank-k update (see `syrk`).
+     */
+    inline void dsyrk(triangle uplo, transposition trans, const int N, const int K, const double alpha, const double* A, const int lda, const double beta, double* C,
+      const int ldc, const int nb_threads, workspace<double>& ws) {
+        syrk<double>(uplo, trans, N, K, alpha, A, lda, beta, C, ldc, nb_threads, ws);
+    }
+
+    /**
+     * @brief Performs simple precision symmetric matrix-matrix multiplication (see `symm`).
+     */
+    inline void ssymm(side sideA, triangle uplo, const int M, const int N, const float alpha, const float* A, const int lda, const float* B, const int ldb, const float beta,
+      float* C, const int ldc) {
+        symm<float>(sideA, uplo, M, N, alpha, A, lda, B, ldb, beta, C, ldc);
+    }
+
+    /**
+     * @brief Performs simple precision symmetric matrix-matrix multiplication (see `symm`).
+     */
+    inline void ssymm(side sideA, triangle uplo, const int M, const int N, const float alpha, const float* A, const int lda, const float* B, const int ldb, const float beta,
+      float* C, const int ldc, const int nb_threads) {
+        symm<float>(sideA, uplo, M, N, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads);
+    }
+
+    /**
+     * @brief Performs simple precision symmetric matrix-matrix multiplication (see `symm`).
+     */
+    inline void ssymm(side sideA, triangle uplo, const int M, const int N, const float alpha, const float* A, const int lda, const float* B, const int ldb, const float beta,
+      float* C, const int ldc, const int nb_threads, workspace<float>& ws) {
+        symm<float>(sideA, uplo, M, N, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads, ws);
+    }
+
+    /**
+     * @brief Performs double precision symmetric matrix-matrix multiplication (see `symm`).
+     */
+    inline void dsymm(side sideA, triangle uplo, const int M, const int N, const double alpha, const double* A, const int lda, const double* B, const int ldb, const double beta,
+      double* C, const int ldc) {
+        symm<double>(sideA, uplo, M, N, alpha, A, lda, B, ldb, beta, C, ldc);
+    }
+
+    /**
+     * @brief Performs double precision symmetric matrix-matrix multiplication (see `symm`).
+     */
+    inline void dsymm(side sideA, triangle uplo, const int M, const int N, const double alpha, const double* A, const int lda, const double* B, const int ldb, const double beta,
+      double* C, const int ldc, const int nb_threads) {
+        symm<double>(sideA, uplo, M, N, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads);
+    }
+
+    /**
+     * @brief Performs double precision symmetric matrix-matrix multiplication (see `symm`).
+     */
+    inline void dsymm(side sideA, triangle uplo, const int M, const int N, const double alpha, const double* A, const int lda, const double* B, const int ldb, const double beta,
+      double* C, const int ldc, const int nb_threads, workspace<double>& ws) {
+        symm<double>(sideA, uplo, M, N, alpha, A, lda, B, ldb, beta, C, ldc, nb_threads, ws);
+    }
+} // namespace gemm
+
+#endif
@@ -0,0 +1,439 @@
+#ifndef GEMM_TRIANGULAR_HPP
+#define GEMM_TRIANGULAR_HPP
+
+#include <eve/eve.hpp>
+#include <eve/module/core.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+#include "gemm/gemm.hpp"
+
+namespace gemm
+{
+    namespace detail
+    {
+        /**
+         * @brief Size of the diagonal blocks of the triangular matrices: the products with the rest of the matrix are
+         * made by `multiply`, only the diagonal blocks by the triangular kernels.
+         */
+        constexpr int triangular_block = 64;
+
+        /**
+         * @brief Number of columns of `B` processed together by the triangular kernels of the left side, so that the
+         * rows of a diagonal block stay in cache while they are combined.
+         */
+        constexpr int triangular_strip = 256;
+
+        /**
+         * @brief Computes `y += a * x` on `n` consecutive elements.
+         */
+        template<typename T>
+        void row_axpy(const int n, const T a, const T* x, T* y) {
+            using wide_t = eve::wide<T>;
+            constexpr int size = wide_t::size();
+
+            int j = 0;
+            for (; j + size <= n; j += size) {
+                eve::store(eve::fma(wide_t{a}, wide_t{x + j}, wide_t{y + j}), y + j);
+            }
+            for (; j < n; j++) {
+                y[j] += a * x[j];
+            }
+        }
+
+        /**
+         * @brief Computes `y *= a` on `n` consecutive elements.
+         */
+        template<typename T>
+        void row_scale(const int n, const T a, T* y) {
+            using wide_t = eve::wide<T>;
+            constexpr int size = wide_t::size();
+
+            int j = 0;
+            for (; j + size <= n; j += size) {
+                eve::store(a * wide_t{y + j}, y + j);
+            }
+            for (; j < n; j++) {
+                y[j] *= a;
+            }
+        }
+
+        /**
+         * @brief Copies the `size x size` diagonal block of the triangular matrix `op(A)` starting at its first element to
+         * the row major matrix `D`, with zeros in the other triangle, and ones on the diagonal if it is `unit`.
+         */
+        template<typename T>
+        void pack_triangle(const operand<T>& A, const int size, const bool lower, const bool unit, T* D) {
+            for (int r = 0; r < size; r++) {
+                for (int c = 0; c < size; c++) {
+                    const bool inside = lower ? c <= r : c >= r;
+                    D[r * size + c] = r == c && unit ? T{1} : inside ? *A.at(r, c) : T{0};
+                }
+            }
+        }
+
+        /**
+         * @brief Overwrites the `size x cols` block `X` of `B` with the solution `Y` of `D Y = X`, `D` being a
+         * `size x size` triangular matrix: the rows are solved one after the other, each one being subtracted from the
+         * rows which depend on it.
+         */
+        template<typename T>
+        void solve_triangle_left(const bool lower, const int size, const T* D, const int cols, T* X, const int ldx) {
+            for (int s = 0; s < size; s++) {
+                const int k = lower ? s : size - 1 - s;
+                T* x_k = X + k * ldx;
+                row_scale(cols, T{1} / D[k * size + k], x_k);
+                const int first = lower ? k + 1 : 0;
+                const int last = lower ? size : k;
+                for (int r = first; r < last; r++) {
+                    row_axpy(cols, -D[r * size + k], x_k, X + r * ldx);
+                }
+            }
+        }
+
+        /**
+         * @brief Computes `X = alpha * D X` in place, `D` being a `size x size` triangular matrix and `X` the
+         * `size x cols` block of `B` starting at `X`: each row is replaced by its combination with the rows which have
+         * not been replaced yet.
+         */
+        template<typename T>
+        void multiply_triangle_left(const bool lower, const int size, const T* D, const T alpha, const int cols, T* X, const int ldx) {
+            for (int s = 0; s < size; s++) {
+                const int r = lower ? size - 1 - s : s;
+                T* x_r = X + r * ldx;
+                row_scale(cols, alpha * D[r * size + r], x_r);
+                const int first = lower ? 0 : r + 1;
+                const int last = lower ? r : size;
+                for (int k = first; k < last; k++) {
+                    row_axpy(cols, alpha * D[r * size + k], X + k * ldx, x_r);
+                }
+            }
+        }
+
+        /**
+         * @brief Overwrites the row `x` of `size` elements with the solution `y` of `y D = x`, `D` being a `size x size`
+         * triangular matrix: each solved element is subtracted, scaled by its row of `D`, from the elements which depend
+         * on it.
+         */
+        template<typename T>
+        void solve_triangle_right(const bool lower, const int size, const T* D, T* x) {
+            for (int s = 0; s < size; s++) {
+                const int k = lower ? size - 1 - s : s;
+                x[k] /= D[k * size + k];
+                if (lower) {
+                    row_axpy(k, -x[k], D + k * size, x);
+                } else {
+                    row_axpy(size - k - 1, -x[k], D + k * size + k + 1, x + k + 1);
+                }
+            }
+        }
+
+        /**
+         * @brief Computes `x = alpha * x D` in place for the row `x` of `size` elements, `D` being a `size x size`
+         * triangular matrix.
+         */
+        template<typename T>
+        void multiply_triangle_right(const bool lower, const int size, const T* D, const T alpha, T* x) {
+            std::array<T, triangular_block> xD{};
+            for (int k = 0; k < size; k++) {
+                if (lower) {
+                    row_axpy(k + 1, x[k], D + k * size, xD.data());
+                } else {
+                    row_axpy(size - k, x[k], D + k * size + k, xD.data() + k);
+                }
+            }
+            for (int c = 0; c < size; c++) {
+                x[c] = alpha * xD[c];
+            }
+        }
+
+        /**
+         * @brief Triangular multiplication (`B = alpha * op(A)B` or `B = alpha * B op(A)`) or solve (`op(A)X = alpha * B`
+         * or `X op(A) = alpha * B`, `X` overwriting `B`), `op(A)` being a `lower` (or upper) triangular operand,
+         * with a `unit` diagonal which is not read or not, `B` being a `M x N` matrix.
+         *
+         * `op(A)` is split in diagonal blocks of `triangular_block` rows and columns. The rows of `B` facing a block
+         * (its columns on the right side) receive the product of the rest of their row of blocks by the rows of `B`
+         * already solved or not modified yet, which is made by `multiply` with the whole length of the row as `K`, so
+         * nearly all the flops are made by the blocked multiplication. Only the diagonal block is applied by the
+         * triangular kernels. The blocks are processed in the order which keeps the rows read by the product either
+         * solved (solve) or unmodified (multiplication). `work` holds `triangular_workspace_size` elements.
+         */
+        template<typename T>
+        void triangular(const bool solve, const bool left, const bool lower, const bool unit, const int M, const int N, const T alpha,
+          const operand<T> A, T* B, const int ldb, const int nb_threads, T* work) {
+            if (M == 0 || N == 0) {
+                return;
+            }
+
+            // the solve is made on alpha * B, B is not read if alpha is 0
+            if (alpha == T{0} || (solve && alpha != T{1})) {
+                parallel_for(M, nb_threads, [=](const int i, int) {
+                    T* b = B + static_cast<std::size_t>(i) * ldb;
+                    for (int j = 0; j < N; j++) {
+                        b[j] = alpha == T{0} ? T{0} : alpha * b[j];
+                    }
+                });
+            }
+            if (alpha == T{0}) {
+                return;
+            }
+
+            // the product of a block uses the rows (columns) of B which come before it if op(A) is lower (upper)
+            const int dim = left ? M : N;
+            const bool before = left == lower;
+            const bool forward = before == solve;
+            const int nb_blocks = (dim + triangular_block - 1) / triangular_block;
+            T* D = work;
+            T* gemm_work = D + triangular_block * triangular_block;
+
+            for (int b = 0; b < nb_blocks; b++) {
+                const int p0 = (forward ? b : nb_blocks - 1 - b) * triangular_block;
+                const int size = std::min(triangular_block, dim - p0);
+                const int k0 = before ? 0 : p0 + size;
+                const int length = before ? p0 : dim - p0 - size;
+                pack_triangle(A.from(p0, p0), size, lower, unit, D);
+
+                const T scale = solve ? T{-1} : alpha;
+                const auto update = [&] {
+                    if (length == 0) {
+                        return;
+                    }
+                    if (left) {
+                        multiply(A.transposed, false, size, N, length, scale, A.at(p0, k0), A.ld, B + k0 * ldb, ldb, T{1}, B + p0 * ldb, ldb, nb_threads,
+                          gemm_work);
+                    } else {
+                        multiply(false, A.transposed, M, size, length, scale, B + k0, ldb, A.at(k0, p0), A.ld, T{1}, B + p0, ldb, nb_threads, gemm_work);
+                    }
+                };
+
+                const auto apply_diagonal = [&] {
+                    if (left) {
+                        const int nb_strips = (N + triangular_strip - 1) / triangular_strip;
+                        parallel_for(nb_strips, nb_threads, [=](const int strip, int) {
+                            const int j = strip * triangular_strip;
+                            const int cols = std::min(triangular_strip, N - j);
+                            T* X = B + p0 * ldb + j;
+                            if (solve) {
+                                solve_triangle_left(lower, size, D, cols, X, ldb);
+                            } else {
+                                multiply_triangle_left(lower, size, D, alpha, cols, X, ldb);
+                            }
+                        });
+                    } else {
+                        parallel_for(M, nb_threads, [=](const int i, int) {
+                            T* x = B + static_cast<std::size_t>(i) * ldb + p0;
+                            if (solve) {
+                                solve_triangle_right(lower, size, D, x);
+                            } else {
+                                multiply_triangle_right(lower, size, D, alpha, x);
+                            }
+                        });
+                    }
+                };
+
+                if (solve) {
+                    update();
+                    apply_diagonal();
+                } else {
+                    apply_diagonal();
+                    update();
+                }
+            }
+        }
+    } // namespace detail
+
+    /**
+     * @brief Returns the number of elements of the workspace needed by `trmm` and `trsm` with a `M x N` matrix `B` and
+     * the triangular matrix on the side `sideA`, using at most `nb_threads` threads.
+     *
+     * The workspace holds a diagonal block, followed by the workspace of the largest product of `trmm` or `trsm`.
+     */
+    template<typename T>
+    std::size_t triangular_workspace_size(side sideA, const int M, const int N, const int nb_threads = get_num_threads()) {
+        const int threads = std::clamp(nb_threads, 1, detail::max_threads());
+        const bool left = sideA == side::left;
+        const int m = left ? std::min(M, detail::triangular_block) : M;
+        const int n = left ? N : std::min(N, detail::triangular_block);
+        const int k = left ? M : N;
+        const std::size_t products = std::max({detail::small_workspace_size(m, n, k), detail::skinny_workspace_size(m, n, k, threads),
+          detail::blocked_workspace_size<T>(get_blocking<T>(), n, threads)});
+        return detail::triangular_block * detail::triangular_block + products;
+    }
+
+    /**
+     * @brief Performs the triangular multiplication `B = alpha * op(A)B` (`sideA` is `left`) or `B = alpha * B op(A)`
+     * (`sideA` is `right`), using at most `nb_threads` threads and the buffers of `ws`.
+     *
+     * `B` is a `M x N` matrix, and `A` is a `M x M` (left) or `N x N` (right) triangular matrix of which only the
+     * triangle `uplo` is read, its diagonal being assumed to be ones if `diag` is `unit`. Most of the product is made
+     * by the blocked multiplication, only the diagonal blocks of `A` being applied by dedicated kernels. The other
+     * parameters are the ones of `gemm`.
+     */
+    template<typename T>
+    void trmm(side sideA, triangle uplo, transposition transA, diagonal diag, const int M, const int N, const T alpha, const T* A, const int lda, T* B,
+      const int ldb, const int nb_threads, workspace<T>& ws) {
+        const int threads = std::clamp(nb_threads, 1, detail::max_threads());
+        ws.reserve(triangular_workspace_size<T>(sideA, M, N, threads));
+        const bool transposed = transA != transposition::none;
+        const bool lower = (uplo == triangle::lower) != transposed;
+        detail::triangular(false, sideA == side::left, lower, diag == diagonal::unit, M, N, alpha, detail::operand<T>{A, lda, transposed}, B, ldb,
+          threads, ws.data());
+    }
+
+    /**
+     * @brief Performs the triangular multiplication using at most `nb_threads` threads and the workspace of the calling
+     * thread.
+     */
+    template<typename T>
+    void trmm(side sideA, triangle uplo, transposition transA, diagonal diag, const int M, const int N, const T alpha, const T* A, const int lda, T* B,
+      const int ldb, const int nb_threads) {
+        trmm<T>(sideA, uplo, transA, diag, M, N, alpha, A, lda, B, ldb, nb_threads, detail::default_workspace<T>());
+    }
+
+    /**
+     * @brief Performs the triangular multiplication using the process wide number of threads.
+     */
+    template<typename T>
+    void trmm(side sideA, triangle uplo, transposition transA, diagonal diag, const int M, const int N, const T alpha, const T* A, const int lda, T* B,
+      const int ldb) {
+        trmm<T>(sideA, uplo, transA, diag, M, N, alpha, A, lda, B, ldb, get_num_threads());
+    }
+
+    /**
+     * @brief Solves the triangular system `op(A)X = alpha * B` (`sideA` is `left`) or `X op(A) = alpha * B` (`sideA` is
+     * `right`), `X` overwriting `B`, using at most `nb_threads` threads and the buffers of `ws`.
+     *
+     * The parameters are the ones of `trmm`. The right-hand sides are updated with the solved ones by the blocked
+     * multiplication, only the diagonal blocks of `A` being solved by dedicated kernels. `A` is not checked for
+     * singularity.
+     */
+    template<typename T>
+    void trsm(side sideA, triangle uplo, transposition transA, diagonal diag, const int M, const int N, const T alpha, const T* A, const int lda, T* B,
+      const int ldb, const int nb_threads, workspace<T>& ws) {
+        const int threads = std::clamp(nb_threads, 1, detail::max_threads());
+        ws.reserve(triangular_workspace_size<T>(sideA, M, N, threads));
+        const bool transposed = transA != transposition::none;
+        const bool lower = (uplo == triangle::lower) != transposed;
+        detail::triangular(true, sideA == side::left, lower, diag == diagonal::unit, M, N, alpha, detail::operand<T>{A, lda, transposed}, B, ldb,
+          threads, ws.data());
+    }
+
+    /**
+     * @brief Solves the triangular system using at most `nb_threads` threads and the workspace of the calling thread.
+     */
+    template<typename T>
+    void trsm(side sideA, triangle uplo, transposition transA, diagonal diag, const int M, const int N, const T alpha, const T* A, const int lda, T* B,
+      const int ldb, const int nb_threads) {
+        trsm<T>(sideA, uplo, transA, diag, M, N, alpha, A, lda, B, ldb, nb_threads, detail::default_workspace<T>());
+    }
+
+    /**
+     * @brief Solves the triangular system using the process wide number of threads.
+     */
+    template<typename T>
+    void trsm(side sideA, triangle uplo, transposition transA, diagonal diag, const int M, const int N, const T alpha, const T* A, const int lda, T* B,
+      const int ldb) {
+        trsm<T>(sideA, uplo, transA, diag, M, N, alpha, A, lda, B, ldb, get_num_threads());
+    }
+
+    /**
+     * @brief Performs simple precision triangular matrix-matrix multiplication (see `trmm`).
+     */
+    inline void strmm(side sideA, triangle uplo, transposition transA, diagonal diag, const int M, const int N, const float alpha, const float* A, const int lda,
+      float* B, const int ldb) {
+        trmm<float>(sideA, uplo, transA, diag, M, N, alpha, A, lda, B, ldb);
+    }
+
+    /**
+     * @brief Performs simple precision triangular matrix-matrix multiplication (see `trmm`).
+     */
+    inline void strmm(side sideA, triangle uplo, transposition transA, diagonal diag, const int M, const int N, const float alpha, const float* A, const int lda,
+      float* B, const int ldb, const int nb_threads) {
+        trmm<float>(sideA, uplo, transA, diag, M, N, alpha, A, lda, B, ldb, nb_threads);
+    }
+
+    /**
+     * @brief Performs simple precision triangular matrix-matrix multiplication (see `trmm`).
+     */
+    inline void strmm(side sideA, triangle uplo, transposition transA, diagonal diag, const int M, const int N, const float alpha, const float* A, const int lda,
+      float* B, const int ldb, const int nb_threads, workspace<float>& ws) {
+        trmm<float>(sideA, uplo, transA, diag, M, N, alpha, A, lda, B, ldb, nb_threads, ws);
+    }
+
+    /**
+     * @brief Performs double precision triangular matrix-matrix multiplication (see `trmm`).
+     */
+    inline void dtrmm(side sideA, triangle uplo, transposition transA, diagonal diag, const int M, const int N, const double alpha, const double* A, const int lda,
+      double* B, const int ldb) {
+        trmm<double>(sideA, uplo, transA, diag, M, N, alpha, A, lda, B, ldb);
+    }
+
+    /**
+     * @brief Performs double precision triangular matrix-matrix multiplication (see `trmm`).
+     */
+    inline void dtrmm(side sideA, triangle uplo, transposition transA, diagonal diag, const int M, const int N, const double alpha, const double* A, const int lda,
+      double* B, const int ldb, const int nb_threads) {
+        trmm<double>(sideA, uplo, transA, diag, M, N, alpha, A, lda, B, ldb, nb_threads);
+    }
+
+    /**
+     * @brief Performs double precision triangular matrix-matrix multiplication (see `trmm`).
+     */
+    inline void dtrmm(side sideA, triangle uplo, transposition transA, diagonal diag, const int M, const int N, const double alpha, const double* A, const int lda,
+      double* B, const int ldb, const int nb_threads, workspace<double>& ws) {
+        trmm<double>(sideA, uplo, transA, diag, M, N, alpha, A, lda, B, ldb, nb_threads, ws);
+    }
+
+    /**
+     * @brief Solves simple precision triangular systems (see `trsm`).
+     */
+    inline void strsm(side sideA, triangle uplo, transposition transA, diagonal diag, const int M, const int N, const float alpha, const float* A, const int lda,
+      float* B, const int ldb) {
+        trsm<float>(sideA, uplo, transA, diag, M, N, alpha, A, lda, B, ldb);
+    }
+
+    /**
+     * @brief Solves simple precision triangular systems (see `trsm`).
+     */
+    inline void strsm(side sideA, triangle uplo, transposition transA, diagonal diag, const int M, const int N, const float alpha, const float* A, const int lda,
+      float* B, const int ldb, const int nb_threads) {
+        trsm<float>(sideA, uplo, transA, diag, M, N, alpha, A, lda, B, ldb, nb_threads);
+    }
+
+    /**
+     * @brief Solves simple precision triangular systems (see `trsm`).
+     */
+    inline void strsm(side sideA, triangle uplo, transposition transA, diagonal diag, const int M, const int N, const float alpha, const float* A, const int lda,
+      float* B, const int ldb, const int nb_threads, workspace<float>& ws) {
+        trsm<float>(sideA, uplo, transA, diag, M, N, alpha, A, lda, B, ldb, nb_threads, ws);
+    }
+
+    /**
+     * @brief Solves double precision triangular systems (see `trsm`).
+     */
+    inline void dtrsm(side sideA, triangle uplo, transposition transA, diagonal diag, const int M, const int N, const double alpha, const double* A, const int lda,
+      double* B, const int ldb) {
+        trsm<double>(sideA, uplo, transA, diag, M, N, alpha, A, lda, B, ldb);
+    }
+
+    /**
+     * @brief Solves double precision triangular systems (see `trsm`).
+     */
+    inline void dtrsm(side sideA, triangle uplo, transposition transA, diagonal diag, const int M, const int N, const double alpha, const double* A, const int lda,
+      double* B, const int ldb, const int nb_threads) {
+        trsm<double>(sideA, uplo, transA, diag, M, N, alpha, A, lda, B, ldb, nb_threads);
+    }
+
+    /**
+     * @brief Solves double precision triangular systems (see `trsm`).
+     */
+    inline void dtrsm(side sideA, triangle uplo, transposition transA, diagonal diag, const int M, const int N, const double alpha, const double* A, const int lda,
+      double* B, const int ldb, const int nb_threads, workspace<double>& ws) {
+        trsm<double>(sideA, uplo, transA, diag, M, N, alpha, A, lda, B, ldb, nb_threads, ws);
+    }
+} // namespace gemm
+
+#endif
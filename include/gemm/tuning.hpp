@@ -0,0 +1,195 @@
+#ifndef GEMM_TUNING_HPP
+#define GEMM_TUNING_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include "gemm/detail/blocking.hpp"
+#include "gemm/detail/cache.hpp"
+#include "gemm/types.hpp"
+
+namespace gemm
+{
+    namespace detail
+    {
+        template<typename T>
+        constexpr std::string_view type_name = "";
+
+        template<>
+        inline constexpr std::string_view type_name<float> = "float";
+
+        template<>
+        inline constexpr std::string_view type_name<double> = "double";
+
+        /**
+         * @brief Reads the entry of type `T` of a tuning profile.
+         *
+         * A profile has one line per type: the name of the type followed by `BM`, `BN`, `BK` and the tile height.
+         * Empty lines and lines starting with `#` are ignored. Returns false if there is no valid entry for `T`.
+         */
+        template<typename T>
+        bool read_tuning_profile(std::istream& input, blocking& sizes) {
+            std::string line;
+            while (std::getline(input, line)) {
+                std::istringstream fields(line);
+                std::string name;
+                blocking entry{};
+                if (fields >> name && name == type_name<T> && fields >> entry.BM >> entry.BN >> entry.BK >> entry.tile_height && is_valid<T>(entry)) {
+                    sizes = entry;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Writes the entry of type `T` of a tuning profile.
+         */
+        template<typename T>
+        void write_tuning_profile(std::ostream& output, const blocking& sizes) {
+            output << type_name<T> << ' ' << sizes.BM << ' ' << sizes.BN << ' ' << sizes.BK << ' ' << sizes.tile_height << '\n';
+        }
+
+        /**
+         * @brief Rounds `value` down to a multiple of `multiple`, clamped to [multiple, max].
+         */
+        constexpr int round_block_size(const std::size_t value, const int multiple, const int max) {
+            const int clamped = static_cast<int>(std::min<std::size_t>(value, max));
+            return std::max(multiple, clamped - clamped % multiple);
+        }
+
+        /**
+         * @brief Block sizes derived from the cache sizes, using half of each level for the data meant to stay in it:
+         * - L1: the `TILE_HEIGHT x BK` rows of the block of `A` and the `BK x TILE_WIDTH` columns of the block of `B`
+         *   read by a tile, the rows being reused for all the tiles of a row,
+         * - L2: the `BK x BN` block of `B`, reused for all the rows of tiles,
+         * - L3 (the part of a core, or L2 if there is no L3): the `BM x BK` block of `A`, reused for all the blocks
+         *   of `B` of a panel.
+         *
+         * Returns the default sizes if the caches are unknown.
+         */
+        template<typename T>
+        constexpr blocking model_blocking(const cache_sizes& caches) {
+            if (!caches.detected()) {
+                return default_blocking<T>;
+            }
+
+            constexpr int tile_height = TILE_HEIGHT<T>;
+            constexpr int tile_width = TILE_WIDTH<T>;
+            const std::size_t last_level = caches.L3 != 0 ? caches.L3 : caches.L2;
+
+            blocking sizes{};
+            sizes.tile_height = tile_height;
+            sizes.BK = round_block_size(caches.L1 / 2 / (sizeof(T) * (tile_height + tile_width)), 8, 512);
+            sizes.BN = round_block_size(caches.L2 / 2 / (sizeof(T) * sizes.BK), tile_width, 1024);
+            sizes.BM = round_block_size(last_level / 2 / (sizeof(T) * sizes.BK), tile_height, 1024);
+            return sizes;
+        }
+
+        /**
+         * @brief Number of columns of the panels of `op(B)` packed once per K block and shared by all the row blocks
+         * of `A`: as many whole `BN` blocks as fit the `BK x NC` panel in half of the `shared_cache` bytes of the last
+         * level cache, without exceeding the `N` columns of `op(B)`.
+         */
+        template<typename T>
+        constexpr int model_panel_width(const blocking& sizes, const int N, const std::size_t shared_cache) {
+            const int max_width = (N + sizes.BN - 1) / sizes.BN * sizes.BN;
+            return round_block_size(shared_cache / 2 / (sizeof(T) * sizes.BK), sizes.BN, max_width);
+        }
+
+        /**
+         * @brief Number of columns of the panels of `op(B)` for the last level cache of the host (see
+         * `model_panel_width`).
+         */
+        template<typename T>
+        int panel_width(const blocking& sizes, const int N) {
+            return model_panel_width<T>(sizes, N, shared_cache_size());
+        }
+
+        /**
+         * @brief Initial sizes of the process, read from the profile named by the `GEMM_TUNING_PROFILE` environment
+         * variable if it is set and has an entry for `T`. Otherwise they are derived from the caches of the host (see
+         * `model_blocking`), or are the default ones if the caches cannot be detected.
+         */
+        template<typename T>
+        blocking initial_blocking() {
+            blocking sizes = model_blocking<T>(host_cache_sizes());
+            if (const char* path = std::getenv("GEMM_TUNING_PROFILE")) {
+                std::ifstream profile(path);
+                read_tuning_profile<T>(profile, sizes);
+            }
+            return sizes;
+        }
+
+        template<typename T>
+        blocking& process_blocking() {
+            static blocking sizes = initial_blocking<T>();
+            return sizes;
+        }
+    } // namespace detail
+
+    /**
+     * @brief Returns the block and tile sizes used by the multiplications of type `T` of the process.
+     */
+    template<typename T>
+    blocking get_blocking() {
+        return detail::process_blocking<T>();
+    }
+
+    /**
+     * @brief Sets the block and tile sizes used by the multiplications of type `T` of the process, if they are valid
+     * (see `detail::is_valid`). This function is meant to be called at startup, while no multiplication is running.
+     *
+     * @return false if the sizes are invalid, in which case they are ignored
+     */
+    template<typename T>
+    bool set_blocking(const blocking& sizes) {
+        if (!detail::is_valid<T>(sizes)) {
+            return false;
+        }
+        detail::process_blocking<T>() = sizes;
+        return true;
+    }
+
+    /**
+     * @brief Sets the sizes used by the multiplications from the entries of the profile at `path` (as written by the
+     * `autotune` tool). The types without a valid entry keep their sizes.
+     *
+     * @return false if the profile has no valid entry
+     */
+    inline bool load_tuning_profile(const std::string& path) {
+        std::ifstream profile(path);
+        blocking float_sizes = get_blocking<float>();
+        blocking double_sizes = get_blocking<double>();
+        const bool has_float = detail::read_tuning_profile<float>(profile, float_sizes);
+        profile.clear();
+        profile.seekg(0);
+        const bool has_double = detail::read_tuning_profile<double>(profile, double_sizes);
+
+        set_blocking<float>(float_sizes);
+        set_blocking<double>(double_sizes);
+        return has_float || has_double;
+    }
+
+    /**
+     * @brief Writes a profile with the given sizes for `float` and `double` to `path`.
+     *
+     * @return false if the file could not be written
+     */
+    inline bool save_tuning_profile(const std::string& path, const blocking& float_sizes, const blocking& double_sizes) {
+        std::ofstream profile(path);
+        profile << "# gemm tuning profile: type BM BN BK tile_height\n";
+        detail::write_tuning_profile<float>(profile, float_sizes);
+        detail::write_tuning_profile<double>(profile, double_sizes);
+        return static_cast<bool>(profile);
+    }
+} // namespace gemm
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef GEMM_TYPES_HPP
+#define GEMM_TYPES_HPP
+
+namespace gemm
+{
+    enum class transposition {
+        none,
+        transpose,
+        conjugate_transpose
+    };
+
+    /**
+     * @brief Triangle of a symmetric matrix which is read (`symm`) or written (`syrk`), the other one being implied
+     * by symmetry.
+     */
+    enum class triangle {
+        upper,
+        lower
+    };
+
+    /**
+     * @brief Side of the symmetric matrix in `symm`: `C = A * B` (left) or `C = B * A` (right).
+     */
+    enum class side {
+        left,
+        right
+    };
+
+    /**
+     * @brief Diagonal of a triangular matrix in `trmm` and `trsm`: read from the matrix, or made of ones which are not
+     * read (`unit`).
+     */
+    enum class diagonal {
+        non_unit,
+        unit
+    };
+
+    /**
+     * @brief Storage order of the matrices: `lda`, `ldb` and `ldc` are the distances between two rows (row major)
+     * or two columns (column major, as in the reference BLAS).
+     */
+    enum class layout {
+        row_major,
+        column_major
+    };
+
+    /**
+     * @brief Block and tile sizes of the multiplication of large matrices.
+     */
+    struct blocking {
+        int BM;          // rows of A
+        int BN;          // columns of B
+        int BK;          // columns of A/rows of B
+        int tile_height; // rows of a tile of C
+
+        friend bool operator==(const blocking&, const blocking&) = default;
+    };
+} // namespace gemm
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef GEMM_WORKSPACE_HPP
+#define GEMM_WORKSPACE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace gemm
+{
+    /**
+     * @brief Memory used by a matrix multiplication for its intermediate buffers (packed blocks, small products).
+     *
+     * A workspace can be reused by successive calls made from the same thread, so that they do not allocate
+     * memory. Its required size is given by `gemm::workspace_size`.
+     */
+    template<typename T>
+    class workspace
+    {
+      public:
+        workspace() = default;
+
+        /**
+         * @brief Creates a workspace of `size` elements.
+         */
+        explicit workspace(const std::size_t size) {
+            reserve(size);
+        }
+
+        /**
+         * @brief Makes sure the workspace holds at least `size` elements. If it has to grow, its previous
+         * content is lost.
+         */
+        void reserve(const std::size_t size) {
+            if (size > capacity) {
+                buffer.reset(static_cast<T*>(::operator new(size * sizeof(T), std::align_val_t{alignment})));
+                capacity = size;
+            }
+        }
+
+        /**
+         * @brief Number of elements in the workspace.
+         */
+        std::size_t size() const {
+            return capacity;
+        }
+
+        T* data() {
+            return buffer.get();
+        }
+
+      private:
+        static constexpr std::size_t alignment = 64;
+
+        struct deleter {
+            void operator()(T* ptr) const {
+                ::operator delete(ptr, std::align_val_t{alignment});
+            }
+        };
+
+        std::unique_ptr<T, deleter> buffer;
+        std::size_t capacity = 0;
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Workspace used when the caller does not provide one, there is one per thread and per type.
+         * It grows to the largest size requested, after which the calls no longer allocate.
+         */
+        template<typename T>
+        workspace<T>& default_workspace() {
+            static thread_local workspace<T> ws;
+            return ws;
+        }
+    } // namespace detail
+} // namespace gemm
+
+#endif
@@ -0,0 +1,211 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <gemm/batch.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "util.hpp"
+
+using Catch::Matchers::WithinRel;
+
+TEMPLATE_TEST_CASE("batch of uniform multiplications", "[batch]", float, double) {
+    constexpr int batch_size = 100;
+    auto nb_threads = GENERATE(1, 4);
+    auto transA = GENERATE(gemm::transposition::none, gemm::transposition::transpose);
+    auto M = GENERATE(4, 13, 32);
+    auto N = GENERATE(4, 32);
+    auto K = GENERATE(4, 9, 32);
+
+    CAPTURE(nb_threads, transA, M, N, K);
+    const int lda = transA == gemm::transposition::none ? K : M;
+    const TestType alpha = util::random_float<TestType>();
+    const TestType beta = util::random_float<TestType>();
+
+    const auto A = util::random_vector<TestType>(batch_size * M * K);
+    const auto B = util::random_vector<TestType>(batch_size * K * N);
+    auto C = util::random_vector<TestType>(batch_size * M * N);
+    auto C2 = C;
+
+    std::vector<const TestType*> A_array;
+    std::vector<const TestType*> B_array;
+    std::vector<TestType*> C_array;
+    for (int i = 0; i < batch_size; i++) {
+        A_array.push_back(A.data() + i * M * K);
+        B_array.push_back(B.data() + i * K * N);
+        C_array.push_back(C.data() + i * M * N);
+    }
+
+    gemm::gemm_batch<TestType>(transA, gemm::transposition::none, M, N, K, alpha, A_array.data(), lda, B_array.data(), N, beta, C_array.data(), N,
+      batch_size, nb_threads);
+    for (int i = 0; i < batch_size; i++) {
+        util::cblas_gemm(
+          transA, gemm::transposition::none, M, N, K, alpha, A_array[i], lda, B_array[i], N, beta, C2.data() + i * M * N, N);
+    }
+
+    for (std::size_t i = 0; i < C.size(); i++) {
+        CAPTURE(i);
+        REQUIRE_THAT(C[i], WithinRel(C2[i], util::precision<TestType>));
+    }
+}
+
+TEMPLATE_TEST_CASE("batch of groups", "[batch]", float, double) {
+    auto nb_threads = GENERATE(1, 4);
+    CAPTURE(nb_threads);
+
+    // a handwritten kernel, a composed kernel, transposed operands, and the blocked path
+    const std::vector<gemm::transposition> transA = {
+      gemm::transposition::none, gemm::transposition::none, gemm::transposition::transpose, gemm::transposition::none};
+    const std::vector<gemm::transposition> transB = {
+      gemm::transposition::none, gemm::transposition::none, gemm::transposition::transpose, gemm::transposition::transpose};
+    const std::vector<int> M = {4, 11, 20, 130};
+    const std::vector<int> N = {4, 7, 24, 70};
+    const std::vector<int> K = {4, 5, 9, 90};
+    const std::vector<int> group_size = {50, 30, 20, 3};
+    std::vector<TestType> alpha;
+    std::vector<TestType> beta;
+    std::vector<int> lda;
+    std::vector<int> ldb;
+    std::vector<int> ldc;
+
+    std::vector<std::vector<TestType>> A;
+    std::vector<std::vector<TestType>> B;
+    std::vector<std::vector<TestType>> C;
+    std::vector<const TestType*> A_array;
+    std::vector<const TestType*> B_array;
+    std::vector<TestType*> C_array;
+    for (std::size_t g = 0; g < group_size.size(); g++) {
+        alpha.push_back(util::random_float<TestType>());
+        beta.push_back(util::random_float<TestType>());
+        lda.push_back(transA[g] == gemm::transposition::none ? K[g] : M[g]);
+        ldb.push_back(transB[g] == gemm::transposition::none ? N[g] : K[g]);
+        ldc.push_back(N[g]);
+        for (int i = 0; i < group_size[g]; i++) {
+            A.push_back(util::random_vector<TestType>(M[g] * K[g]));
+            B.push_back(util::random_vector<TestType>(K[g] * N[g]));
+            C.push_back(util::random_vector<TestType>(M[g] * N[g]));
+        }
+    }
+    for (std::size_t i = 0; i < A.size(); i++) {
+        A_array.push_back(A[i].data());
+        B_array.push_back(B[i].data());
+        C_array.push_back(C[i].data());
+    }
+    auto C2 = C;
+
+    gemm::gemm_batch<TestType>(transA.data(), transB.data(), M.data(), N.data(), K.data(), alpha.data(), A_array.data(), lda.data(), B_array.data(),
+      ldb.data(), beta.data(), C_array.data(), ldc.data(), static_cast<int>(group_size.size()), group_size.data(), nb_threads);
+
+    std::size_t i = 0;
+    for (std::size_t g = 0; g < group_size.size(); g++) {
+        for (int item = 0; item < group_size[g]; item++, i++) {
+            util::cblas_gemm(
+              transA[g], transB[g], M[g], N[g], K[g], alpha[g], A_array[i], lda[g], B_array[i], ldb[g], beta[g], C2[i].data(), ldc[g]);
+
+            CAPTURE(g, item);
+            for (std::size_t j = 0; j < C[i].size(); j++) {
+                CAPTURE(j);
+                REQUIRE_THAT(C[i][j], WithinRel(C2[i][j], util::precision<TestType>));
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("strided batch", "[batch]", float, double) {
+    constexpr int batch_size = 12;
+    auto nb_threads = GENERATE(1, 4);
+    auto shared_B = GENERATE(false, true);
+    auto M = GENERATE(8, 21, 100);
+    auto N = GENERATE(8, 70);
+    auto K = GENERATE(8, 80);
+
+    CAPTURE(nb_threads, shared_B, M, N, K);
+    const std::ptrdiff_t stride_A = M * K;
+    const std::ptrdiff_t stride_B = shared_B ? 0 : K * N;
+    const std::ptrdiff_t stride_C = M * N;
+    const TestType alpha = util::random_float<TestType>();
+    const TestType beta = util::random_float<TestType>();
+
+    const auto A = util::random_vector<TestType>(batch_size * stride_A);
+    const auto B = util::random_vector<TestType>(shared_B ? K * N : batch_size * stride_B);
+    auto C = util::random_vector<TestType>(batch_size * stride_C);
+    auto C2 = C;
+
+    gemm::gemm_batch_strided<TestType>(gemm::transposition::none, gemm::transposition::none, M, N, K, alpha, A.data(), K, stride_A, B.data(), N,
+      stride_B, beta, C.data(), N, stride_C, batch_size, nb_threads);
+    for (int i = 0; i < batch_size; i++) {
+        util::cblas_gemm(M, N, K, alpha, A.data() + i * stride_A, K, B.data() + i * stride_B, N, beta, C2.data() + i * stride_C, N);
+    }
+
+    for (std::size_t i = 0; i < C.size(); i++) {
+        CAPTURE(i);
+        REQUIRE_THAT(C[i], WithinRel(C2[i], util::precision<TestType>));
+    }
+}
+
+TEMPLATE_TEST_CASE("batch of empty products", "[batch][special]", float, double) {
+    auto nb_threads = GENERATE(1, 4);
+    CAPTURE(nb_threads);
+
+    // small and large products with K = 0, an empty C, and a non empty product after them
+    const std::vector<gemm::transposition> trans(4, gemm::transposition::none);
+    const std::vector<int> M = {20, 130, 0, 11};
+    const std::vector<int> N = {30, 70, 5, 7};
+    const std::vector<int> K = {0, 0, 8, 5};
+    const std::vector<int> group_size = {10, 3, 4, 10};
+    const std::vector<TestType> alpha(4, util::random_float<TestType>());
+    const std::vector<TestType> beta = {TestType{0}, util::random_float<TestType>(), TestType{0}, util::random_float<TestType>()};
+    std::vector<int> lda;
+    std::vector<int> ldb;
+
+    std::vector<std::vector<TestType>> A;
+    std::vector<std::vector<TestType>> B;
+    std::vector<std::vector<TestType>> C;
+    std::vector<const TestType*> A_array;
+    std::vector<const TestType*> B_array;
+    std::vector<TestType*> C_array;
+    for (std::size_t g = 0; g < group_size.size(); g++) {
+        lda.push_back(std::max(K[g], 1));
+        for (int i = 0; i < group_size[g]; i++) {
+            A.push_back(util::random_vector<TestType>(std::max(M[g] * K[g], 1)));
+            B.push_back(util::random_vector<TestType>(std::max(K[g] * N[g], 1)));
+            C.push_back(util::random_vector<TestType>(M[g] * N[g]));
+            // C is not read if beta is 0, so its NaN are not propagated
+            if (beta[g] == 0) {
+                std::fill(C.back().begin(), C.back().end(), std::numeric_limits<TestType>::quiet_NaN());
+            }
+        }
+    }
+    for (std::size_t i = 0; i < A.size(); i++) {
+        A_array.push_back(A[i].data());
+        B_array.push_back(B[i].data());
+        C_array.push_back(C[i].data());
+    }
+    auto C2 = C;
+
+    gemm::gemm_batch<TestType>(trans.data(), trans.data(), M.data(), N.data(), K.data(), alpha.data(), A_array.data(), lda.data(), B_array.data(),
+      N.data(), beta.data(), C_array.data(), N.data(), static_cast<int>(group_size.size()), group_size.data(), nb_threads);
+
+    std::size_t i = 0;
+    for (std::size_t g = 0; g < group_size.size(); g++) {
+        for (int item = 0; item < group_size[g]; item++, i++) {
+            if (K[g] == 0) {
+                for (auto& c : C2[i]) {
+                    c = beta[g] == 0 ? TestType{0} : beta[g] * c;
+                }
+            } else {
+                util::cblas_gemm(M[g], N[g], K[g], alpha[g], A_array[i], lda[g], B_array[i], N[g], beta[g], C2[i].data(), N[g]);
+            }
+
+            CAPTURE(g, item);
+            for (std::size_t j = 0; j < C[i].size(); j++) {
+                CAPTURE(j);
+                REQUIRE_THAT(C[i][j], WithinRel(C2[i][j], util::precision<TestType>));
+            }
+        }
+    }
+}
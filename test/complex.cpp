@@ -0,0 +1,93 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <gemm/complex.hpp>
+
+#include <algorithm>
+#include <complex>
+#include <limits>
+#include <vector>
+
+#include "util.hpp"
+
+namespace
+{
+    template<typename T>
+    std::vector<std::complex<T>> random_complex_vector(const int size) {
+        std::vector<std::complex<T>> v(size);
+        for (auto& e : v) {
+            e = {util::random_float<T>(), util::random_float<T>()};
+        }
+        return v;
+    }
+
+    // Wrapper for the openblas [c|z]gemm function
+    template<typename T>
+    void cblas_complex_gemm(gemm::transposition transA, gemm::transposition transB, const int M, const int N, const int K, const std::complex<T> alpha,
+      const std::complex<T>* A, const int lda, const std::complex<T>* B, const int ldb, const std::complex<T> beta, std::complex<T>* C, const int ldc) {
+        const auto ta = util::cblas_transposition(transA);
+        const auto tb = util::cblas_transposition(transB);
+        if constexpr (std::is_same_v<T, float>) {
+            cblas_cgemm(CblasRowMajor, ta, tb, M, N, K, &alpha, A, lda, B, ldb, &beta, C, ldc);
+        } else {
+            cblas_zgemm(CblasRowMajor, ta, tb, M, N, K, &alpha, A, lda, B, ldb, &beta, C, ldc);
+        }
+    }
+} // namespace
+
+TEMPLATE_TEST_CASE("complex multiplication", "[complex]", float, double) {
+    using complex = std::complex<TestType>;
+
+    auto mode = GENERATE(gemm::complex_mode::standard, gemm::complex_mode::three_m);
+    auto transA = GENERATE(gemm::transposition::none, gemm::transposition::transpose, gemm::transposition::conjugate_transpose);
+    auto transB = GENERATE(gemm::transposition::none, gemm::transposition::conjugate_transpose);
+    auto M = GENERATE(7, 64, 301);
+    auto N = GENERATE(5, 130);
+    auto K = GENERATE(16, 97);
+
+    CAPTURE(mode, transA, transB, M, N, K);
+    const int lda = transA == gemm::transposition::none ? K : M;
+    const int ldb = transB == gemm::transposition::none ? N : K;
+    const complex alpha = {util::random_float<TestType>(), util::random_float<TestType>()};
+    const complex beta = {util::random_float<TestType>(), util::random_float<TestType>()};
+
+    const auto A = random_complex_vector<TestType>(M * K);
+    const auto B = random_complex_vector<TestType>(K * N);
+    auto C = random_complex_vector<TestType>(M * N);
+    auto C2 = C;
+
+    gemm::gemm<TestType>(transA, transB, M, N, K, alpha, A.data(), lda, B.data(), ldb, beta, C.data(), N, 1, mode);
+    cblas_complex_gemm(transA, transB, M, N, K, alpha, A.data(), lda, B.data(), ldb, beta, C2.data(), N);
+
+    // the real and imaginary parts are differences of products, so the error is relative to the magnitude of C
+    TestType magnitude = 0;
+    for (const auto& c : C2) {
+        magnitude = std::max(magnitude, std::abs(c));
+    }
+
+    for (std::size_t i = 0; i < C.size(); i++) {
+        CAPTURE(i, C[i], C2[i]);
+        REQUIRE(std::abs(C[i] - C2[i]) <= util::precision<TestType> * magnitude);
+    }
+}
+
+TEST_CASE("complex multiplication with beta = 0", "[complex]") {
+    constexpr int M = 80;
+    constexpr int N = 70;
+    constexpr int K = 90;
+    const std::complex<double> alpha = {1.5, -0.5};
+
+    const auto A = random_complex_vector<double>(M * K);
+    const auto B = random_complex_vector<double>(K * N);
+    std::vector<std::complex<double>> C(M * N, {std::numeric_limits<double>::quiet_NaN(), 0});
+    std::vector<std::complex<double>> C2(M * N);
+
+    gemm::zgemm(gemm::transposition::none, gemm::transposition::none, M, N, K, alpha, A.data(), K, B.data(), N, 0.0, C.data(), N);
+    cblas_complex_gemm<double>(gemm::transposition::none, gemm::transposition::none, M, N, K, alpha, A.data(), K, B.data(), N, 0.0, C2.data(), N);
+
+    for (std::size_t i = 0; i < C.size(); i++) {
+        CAPTURE(i);
+        REQUIRE(std::abs(C[i] - C2[i]) <= 1e-10 * std::abs(C2[i]) + 1e-10);
+    }
+}
@@ -0,0 +1,40 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <gemm/dispatch.hpp>
+
+#include "util.hpp"
+
+using Catch::Matchers::WithinRel;
+
+TEMPLATE_TEST_CASE("runtime dispatch", "[rectangle][dispatch]", float, double) {
+    auto nb_threads = GENERATE(1, 4);
+    auto transA = GENERATE(gemm::transposition::none, gemm::transposition::transpose);
+    auto M = GENERATE(7, 329);
+    auto N = GENERATE(8, 257);
+    auto K = GENERATE(10, 100);
+
+    CAPTURE(gemm::dispatch::isa_name(gemm::dispatch::selected_isa()), nb_threads, transA, M, N, K);
+    const int lda = transA == gemm::transposition::none ? K : M;
+    const auto A = util::random_vector<TestType>(M * K);
+    const auto B = util::random_vector<TestType>(K * N);
+    auto C = util::random_vector<TestType>(M * N);
+    auto C2 = C;
+
+    const TestType alpha = util::random_float<TestType>();
+    const TestType beta = util::random_float<TestType>();
+
+    if constexpr (std::is_same_v<TestType, float>) {
+        gemm::dispatch::sgemm(transA, gemm::transposition::none, M, N, K, alpha, A.data(), lda, B.data(), N, beta, C.data(), N, nb_threads);
+    } else {
+        gemm::dispatch::dgemm(transA, gemm::transposition::none, M, N, K, alpha, A.data(), lda, B.data(), N, beta, C.data(), N, nb_threads);
+    }
+    util::cblas_gemm(transA, gemm::transposition::none, M, N, K, alpha, A.data(), lda, B.data(), N, beta, C2.data(), N);
+
+    for (std::size_t i = 0; i < C.size(); i++) {
+        CAPTURE(i);
+        REQUIRE_THAT(C[i], WithinRel(C2[i], util::precision<TestType>));
+    }
+}
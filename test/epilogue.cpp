@@ -0,0 +1,75 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <gemm/gemm.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
+#include "util.hpp"
+
+using Catch::Matchers::WithinAbs;
+
+using gemm::activation;
+using gemm::transposition;
+
+TEMPLATE_TEST_CASE("epilogue", "[epilogue]", float, double) {
+    auto transA = GENERATE(transposition::none, transposition::transpose);
+    auto act = GENERATE(activation::none, activation::relu, activation::gelu);
+    auto vectors = GENERATE(0b0000, 0b0101, 0b1010, 0b1111);
+    // small, skinny (both orientations) and blocked multiplications, K spanning several blocks
+    auto dims = GENERATE(std::tuple{20, 30, 10}, std::tuple{3, 1500, 40}, std::tuple{2000, 2, 33}, std::tuple{300, 200, 150});
+    auto nb_threads = GENERATE(1, 4);
+
+    const auto [M, N, K] = dims;
+    CAPTURE(transA, act, vectors, M, N, K, nb_threads);
+    const int lda = (transA == transposition::none ? K : M) + 3;
+    const int ldc = N + 1;
+
+    const auto A = util::random_vector<TestType>((transA == transposition::none ? M : K) * lda);
+    const auto B = util::random_vector<TestType>(K * N);
+    const auto row_scale = util::random_vector<TestType>(M);
+    const auto col_scale = util::random_vector<TestType>(N);
+    const auto row_bias = util::random_vector<TestType>(M);
+    const auto col_bias = util::random_vector<TestType>(N);
+    auto C = util::random_vector<TestType>(M * ldc);
+    auto C2 = C;
+
+    const TestType alpha = util::random_float<TestType>() / K;
+    const TestType beta = util::random_float<TestType>();
+
+    const gemm::epilogue<TestType> post{
+      (vectors & 1) != 0 ? row_scale.data() : nullptr,
+      (vectors & 2) != 0 ? col_scale.data() : nullptr,
+      (vectors & 4) != 0 ? row_bias.data() : nullptr,
+      (vectors & 8) != 0 ? col_bias.data() : nullptr,
+      act,
+    };
+    gemm::gemm<TestType>(transA, transposition::none, M, N, K, alpha, A.data(), lda, B.data(), N, beta, C.data(), ldc, post, nb_threads);
+
+    // reference: a separate pass over C
+    util::cblas_gemm(transA, transposition::none, M, N, K, alpha, A.data(), lda, B.data(), N, beta, C2.data(), ldc);
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < N; j++) {
+            TestType& c = C2[i * ldc + j];
+            c = c * (post.row_scale ? row_scale[i] : 1) * (post.col_scale ? col_scale[j] : 1) + (post.row_bias ? row_bias[i] : 0) +
+                (post.col_bias ? col_bias[j] : 0);
+            if (act == activation::relu) {
+                c = std::max(c, TestType{0});
+            } else if (act == activation::gelu) {
+                c = TestType{0.5} * c * (1 + std::erf(c / std::sqrt(TestType{2})));
+            }
+        }
+    }
+
+    const TestType magnitude = util::max_magnitude(C2);
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < N; j++) {
+            CAPTURE(i, j);
+            REQUIRE_THAT(C[i * ldc + j], WithinAbs(C2[i * ldc + j], util::precision<TestType> * magnitude));
+        }
+    }
+}
@@ -0,0 +1,157 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <gemm/half.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "util.hpp"
+
+namespace
+{
+    // Random 16-bit matrix, and the same values as floats
+    template<typename S>
+    std::pair<std::vector<S>, std::vector<float>> random_half_vector(const int size) {
+        std::vector<S> v(size);
+        std::vector<float> f(size);
+        for (int i = 0; i < size; i++) {
+            v[i] = S(util::random_float<float>());
+            f[i] = v[i];
+        }
+        return {v, f};
+    }
+
+    float max_magnitude(const std::vector<float>& v) {
+        float magnitude = 0;
+        for (const float x : v) {
+            magnitude = std::max(magnitude, std::abs(x));
+        }
+        return magnitude;
+    }
+} // namespace
+
+TEST_CASE("16-bit conversions", "[half]") {
+    REQUIRE(gemm::bfloat16(1.0f).bits == 0x3F80);
+    REQUIRE(gemm::bfloat16(-2.0f).bits == 0xC000);
+    REQUIRE(gemm::bfloat16(1.00390625f).bits == 0x3F80); // tie, rounded to even
+    REQUIRE(std::isnan(static_cast<float>(gemm::bfloat16(std::numeric_limits<float>::quiet_NaN()))));
+
+    REQUIRE(gemm::float16(1.0f).bits == 0x3C00);
+    REQUIRE(gemm::float16(-2.0f).bits == 0xC000);
+    REQUIRE(gemm::float16(65504.0f).bits == 0x7BFF);
+    REQUIRE(gemm::float16(65520.0f).bits == 0x7C00);    // rounded to infinity
+    REQUIRE(gemm::float16(0x1p-24f).bits == 0x0001);    // smallest subnormal
+    REQUIRE(gemm::float16(0x1p-25f).bits == 0x0000);    // tie, rounded to even
+    REQUIRE(gemm::float16(1.00048828125f).bits == 0x3C00); // tie, rounded to even
+    REQUIRE(std::isnan(static_cast<float>(gemm::float16(std::numeric_limits<float>::quiet_NaN()))));
+
+    // every value which is not a NaN survives a round trip through float
+    for (std::uint32_t bits = 0; bits <= 0xFFFF; bits++) {
+        gemm::float16 h;
+        h.bits = static_cast<std::uint16_t>(bits);
+        if (!std::isnan(static_cast<float>(h))) {
+            CAPTURE(bits);
+            REQUIRE(gemm::float16(static_cast<float>(h)).bits == bits);
+        }
+
+        gemm::bfloat16 b;
+        b.bits = static_cast<std::uint16_t>(bits);
+        if (!std::isnan(static_cast<float>(b))) {
+            CAPTURE(bits);
+            REQUIRE(gemm::bfloat16(static_cast<float>(b)).bits == bits);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("16-bit conversions of arrays", "[half]", gemm::bfloat16, gemm::float16) {
+    // every 16-bit value, converted by whole registers and element by element at the end
+    std::vector<TestType> h(0x10000);
+    for (std::size_t bits = 0; bits < h.size(); bits++) {
+        h[bits].bits = static_cast<std::uint16_t>(bits);
+    }
+    std::vector<float> f(h.size());
+    gemm::detail::copy_elements(h.data(), static_cast<int>(h.size()) - 3, f.data());
+    for (std::size_t i = 0; i + 3 < h.size(); i++) {
+        CAPTURE(i);
+        REQUIRE((std::isnan(f[i]) ? std::isnan(static_cast<float>(h[i])) : f[i] == static_cast<float>(h[i])));
+    }
+
+    // the values rounded back, and the floats between them (ties included)
+    std::vector<float> values;
+    for (std::uint32_t bits = 0; bits <= 0xFFFF; bits++) {
+        for (const std::uint32_t low : {0x0000u, 0x0FFFu, 0x1000u, 0x7FFFu, 0x8000u, 0x8001u}) {
+            values.push_back(std::bit_cast<float>((bits << 16) | low));
+        }
+    }
+    std::vector<TestType> rounded(values.size());
+    gemm::detail::copy_elements(values.data(), static_cast<int>(values.size()) - 5, rounded.data());
+    for (std::size_t i = 0; i + 5 < values.size(); i++) {
+        CAPTURE(i, values[i]);
+        const TestType expected(values[i]);
+        if (std::isnan(static_cast<float>(expected))) {
+            REQUIRE(std::isnan(static_cast<float>(rounded[i])));
+        } else {
+            REQUIRE(rounded[i].bits == expected.bits);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("16-bit operands", "[half]", gemm::bfloat16, gemm::float16) {
+    auto transA = GENERATE(gemm::transposition::none, gemm::transposition::transpose);
+    auto transB = GENERATE(gemm::transposition::none, gemm::transposition::transpose);
+    auto M = GENERATE(7, 64, 301);
+    auto N = GENERATE(5, 130);
+    auto K = GENERATE(16, 97);
+
+    CAPTURE(transA, transB, M, N, K);
+    const int lda = transA == gemm::transposition::none ? K : M;
+    const int ldb = transB == gemm::transposition::none ? N : K;
+    const float alpha = util::random_float<float>();
+    const float beta = util::random_float<float>();
+
+    const auto [A, A_float] = random_half_vector<TestType>(M * K);
+    const auto [B, B_float] = random_half_vector<TestType>(K * N);
+    auto C = util::random_vector<float>(M * N);
+    auto C2 = C;
+
+    gemm::gemm<float>(transA, transB, M, N, K, alpha, A.data(), lda, B.data(), ldb, beta, C.data(), N);
+    util::cblas_gemm<float>(transA, transB, M, N, K, alpha, A_float.data(), lda, B_float.data(), ldb, beta, C2.data(), N);
+
+    // the error is relative to the magnitude of C, as the results are sums of products of both signs
+    const float magnitude = max_magnitude(C2);
+    for (std::size_t i = 0; i < C.size(); i++) {
+        CAPTURE(i, C[i], C2[i]);
+        REQUIRE(std::abs(C[i] - C2[i]) <= util::precision<float> * magnitude);
+    }
+}
+
+TEMPLATE_TEST_CASE("16-bit result", "[half]", gemm::bfloat16, gemm::float16) {
+    auto M = GENERATE(9, 150);
+    auto N = GENERATE(13, 200);
+    auto K = GENERATE(20, 300, 2000);
+    auto beta = GENERATE(0.0f, 0.5f);
+
+    CAPTURE(M, N, K, beta);
+    const float alpha = 0.25f;
+
+    const auto [A, A_float] = random_half_vector<TestType>(M * K);
+    const auto [B, B_float] = random_half_vector<TestType>(K * N);
+    auto [C, C_float] = random_half_vector<TestType>(M * N);
+
+    gemm::gemm<float>(gemm::transposition::none, gemm::transposition::none, M, N, K, alpha, A.data(), K, B.data(), N, beta, C.data(), N);
+    util::cblas_gemm<float>(M, N, K, alpha, A_float.data(), K, B_float.data(), N, beta, C_float.data(), N);
+
+    // C is rounded once to 16 bits: the error is the one of the rounding
+    const float epsilon = std::is_same_v<TestType, gemm::bfloat16> ? 0x1p-8f : 0x1p-11f;
+    const float magnitude = max_magnitude(C_float);
+    for (std::size_t i = 0; i < C.size(); i++) {
+        CAPTURE(i, static_cast<float>(C[i]), C_float[i]);
+        REQUIRE(std::abs(C[i] - C_float[i]) <= epsilon * std::abs(C_float[i]) + util::precision<float> * magnitude);
+    }
+}
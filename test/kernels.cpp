@@ -11,8 +11,8 @@ using Catch::Matchers::WithinRel;
 TEMPLATE_TEST_CASE("Microkernels", "[kernels][small]", float, double) {
     Catch::StringMaker<TestType>::precision = 15;
 
-    constexpr TestType alpha = 1.0f;
-    constexpr TestType beta = 1.0f;
+    const auto alpha = static_cast<TestType>(GENERATE(1.0, -0.5));
+    const auto beta = static_cast<TestType>(GENERATE(0.0, 1.0, 2.5));
 
     const auto M = GENERATE(range(1, 9));
     const auto K = GENERATE(range(1, 9));
@@ -21,13 +21,13 @@ TEMPLATE_TEST_CASE("Microkernels", "[kernels][small]", float, double) {
 
     const auto N = GENERATE(range(1, 9));
 
-    CAPTURE(M, N, K);
+    CAPTURE(M, N, K, alpha, beta);
 
     const auto B = util::random_vector<TestType>(K * N);
     auto C = util::random_vector<TestType>(M * N);
     auto C2 = C;
 
-    gemm::detail::get_kernel<TestType>(M, N, K)(A.data(), K, B.data(), N, C.data(), N);
+    gemm::detail::get_kernel<TestType>(M, N, K)(alpha, A.data(), K, B.data(), N, beta, C.data(), N);
     util::cblas_gemm(M, N, K, alpha, A.data(), K, B.data(), N, beta, C2.data(), N);
 
     for (std::size_t i = 0; i < C.size(); i++) {
@@ -0,0 +1,68 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <gemm/gemm.hpp>
+
+#include "util.hpp"
+
+using Catch::Matchers::WithinAbs;
+using Catch::Matchers::WithinRel;
+
+using gemm::transposition;
+
+TEMPLATE_TEST_CASE("column major layout", "[rectangle][layout]", float, double) {
+    auto transA = GENERATE(transposition::none, transposition::transpose);
+    auto transB = GENERATE(transposition::none, transposition::transpose);
+    auto M = GENERATE(5, 63, 329);
+    auto N = GENERATE(8, 17, 257);
+    auto K = GENERATE(1, 30, 100);
+
+    CAPTURE(transA, transB, M, N, K);
+    // the leading dimensions are the distances between two columns
+    const int lda = (transA == transposition::none ? M : K) + 3;
+    const int ldb = (transB == transposition::none ? K : N) + 5;
+    const int ldc = M + 1;
+
+    const auto A = util::random_vector<TestType>((transA == transposition::none ? K : M) * lda);
+    const auto B = util::random_vector<TestType>((transB == transposition::none ? N : K) * ldb);
+    auto C = util::random_vector<TestType>(N * ldc);
+    auto C2 = C;
+
+    const TestType alpha = util::random_float<TestType>();
+    const TestType beta = util::random_float<TestType>();
+
+    gemm::gemm<TestType>(gemm::layout::column_major, transA, transB, M, N, K, alpha, A.data(), lda, B.data(), ldb, beta, C.data(), ldc);
+    const auto ta = util::cblas_transposition(transA);
+    const auto tb = util::cblas_transposition(transB);
+    if constexpr (std::is_same_v<TestType, float>) {
+        cblas_sgemm(CblasColMajor, ta, tb, M, N, K, alpha, A.data(), lda, B.data(), ldb, beta, C2.data(), ldc);
+    } else {
+        cblas_dgemm(CblasColMajor, ta, tb, M, N, K, alpha, A.data(), lda, B.data(), ldb, beta, C2.data(), ldc);
+    }
+
+    // the results close to 0 come from cancellations, they are compared with an absolute tolerance
+    for (std::size_t i = 0; i < C.size(); i++) {
+        CAPTURE(i);
+        REQUIRE_THAT(C[i], WithinRel(C2[i], util::precision<TestType>) || WithinAbs(C2[i], util::precision<TestType>));
+    }
+}
+
+TEMPLATE_TEST_CASE("row major layout", "[rectangle][layout]", float, double) {
+    const int M = 70;
+    const int N = 45;
+    const int K = 33;
+    const auto A = util::random_vector<TestType>(M * K);
+    const auto B = util::random_vector<TestType>(K * N);
+    auto C = util::random_vector<TestType>(M * N);
+    auto C2 = C;
+
+    gemm::gemm<TestType>(gemm::layout::row_major, transposition::none, transposition::none, M, N, K, 1, A.data(), K, B.data(), N, 1, C.data(), N);
+    util::cblas_gemm<TestType>(M, N, K, 1, A.data(), K, B.data(), N, 1, C2.data(), N);
+
+    for (std::size_t i = 0; i < C.size(); i++) {
+        CAPTURE(i);
+        REQUIRE_THAT(C[i], WithinRel(C2[i], util::precision<TestType>));
+    }
+}
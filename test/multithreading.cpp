@@ -0,0 +1,46 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <gemm/gemm.hpp>
+
+#include "util.hpp"
+
+using Catch::Matchers::WithinRel;
+
+TEMPLATE_TEST_CASE("multiple threads", "[rectangle][threads]", float, double) {
+    auto nb_threads = GENERATE(2, 3, 8);
+    auto M = GENERATE(72, 329, 1024);
+    auto N = GENERATE(64, 257);
+    auto K = GENERATE(10, 100);
+
+    CAPTURE(nb_threads, M, N, K);
+    const auto A = util::random_vector<TestType>(M * K);
+    const auto B = util::random_vector<TestType>(K * N);
+    auto C = util::random_vector<TestType>(M * N);
+    auto C2 = C;
+
+    const TestType alpha = util::random_float<TestType>();
+    const TestType beta = util::random_float<TestType>();
+
+    gemm::gemm<TestType>(gemm::transposition::none, gemm::transposition::none, M, N, K, alpha, A.data(), K, B.data(), N, beta, C.data(), N, nb_threads);
+    util::cblas_gemm(M, N, K, alpha, A.data(), K, B.data(), N, beta, C2.data(), N);
+
+    for (std::size_t i = 0; i < C.size(); i++) {
+        CAPTURE(i);
+        REQUIRE_THAT(C[i], WithinRel(C2[i], util::precision<TestType>));
+    }
+}
+
+TEST_CASE("process wide number of threads", "[threads]") {
+    const int previous = gemm::get_num_threads();
+
+    gemm::set_num_threads(4);
+    REQUIRE(gemm::get_num_threads() == 4);
+
+    gemm::set_num_threads(0);
+    REQUIRE(gemm::get_num_threads() == 1);
+
+    gemm::set_num_threads(previous);
+}
@@ -0,0 +1,47 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <gemm/gemm.hpp>
+
+#include "util.hpp"
+
+using Catch::Matchers::WithinRel;
+
+using gemm::transposition;
+
+TEMPLATE_TEST_CASE("packed B", "[rectangle][packed]", float, double) {
+    auto transA = GENERATE(transposition::none, transposition::transpose);
+    auto transB = GENERATE(transposition::none, transposition::transpose);
+    auto N = GENERATE(8, 63, 257);
+    auto K = GENERATE(1, 30, 100);
+
+    CAPTURE(transA, transB, N, K);
+    const int ldb = transB == transposition::none ? N : K;
+    const auto B = util::random_vector<TestType>((transB == transposition::none ? K : N) * ldb);
+    const gemm::packed_matrix<TestType> packed_B(transB, K, N, B.data(), ldb);
+
+    REQUIRE(packed_B.rows() == K);
+    REQUIRE(packed_B.cols() == N);
+
+    // the same packed matrix is reused for multiple multiplications
+    for (const int M : {5, 63, 329}) {
+        CAPTURE(M);
+        const int lda = transA == transposition::none ? K : M;
+        const auto A = util::random_vector<TestType>((transA == transposition::none ? M : K) * lda);
+        auto C = util::random_vector<TestType>(M * N);
+        auto C2 = C;
+
+        const TestType alpha = util::random_float<TestType>();
+        const TestType beta = util::random_float<TestType>();
+
+        gemm::gemm<TestType>(transA, M, alpha, A.data(), lda, packed_B, beta, C.data(), N);
+        util::cblas_gemm(transA, transB, M, N, K, alpha, A.data(), lda, B.data(), ldb, beta, C2.data(), N);
+
+        for (std::size_t i = 0; i < C.size(); i++) {
+            CAPTURE(i);
+            REQUIRE_THAT(C[i], WithinRel(C2[i], util::precision<TestType>));
+        }
+    }
+}
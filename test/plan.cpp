@@ -0,0 +1,74 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <gemm/plan.hpp>
+
+#include <tuple>
+
+#include "util.hpp"
+
+using Catch::Matchers::WithinAbs;
+
+using gemm::transposition;
+
+TEMPLATE_TEST_CASE("execution plans", "[plan]", float, double) {
+    auto transA = GENERATE(transposition::none, transposition::transpose);
+    auto transB = GENERATE(transposition::none, transposition::transpose);
+    // small (handwritten, composed and split kernels), skinny and blocked multiplications
+    auto dims = GENERATE(std::tuple{4, 8, 2}, std::tuple{13, 7, 11}, std::tuple{37, 63, 50}, std::tuple{3, 700, 90}, std::tuple{150, 170, 200},
+      std::tuple{20, 30, 0});
+    auto nb_threads = GENERATE(1, 4);
+
+    const auto [M, N, K] = dims;
+    CAPTURE(transA, transB, M, N, K, nb_threads);
+    const int lda = (transA == transposition::none ? K : M) + 3;
+    const int ldb = (transB == transposition::none ? N : K) + 5;
+    const int ldc = N + 1;
+
+    gemm::gemm_plan<TestType> plan(transA, transB, M, N, K, lda, ldb, ldc, nb_threads);
+
+    // the plan is executed several times with other operands
+    for (int run = 0; run < 2; run++) {
+        CAPTURE(run);
+        const auto A = util::random_vector<TestType>((transA == transposition::none ? M : K) * lda);
+        const auto B = util::random_vector<TestType>((transB == transposition::none ? K : N) * ldb);
+        auto C = util::random_vector<TestType>(M * ldc);
+        auto C2 = C;
+
+        const TestType alpha = util::random_float<TestType>();
+        const TestType beta = util::random_float<TestType>();
+
+        plan.execute(alpha, A.data(), B.data(), beta, C.data());
+        util::cblas_gemm(transA, transB, M, N, K, alpha, A.data(), lda, B.data(), ldb, beta, C2.data(), ldc);
+
+        const TestType magnitude = util::max_magnitude(C2);
+        for (std::size_t i = 0; i < C.size(); i++) {
+            CAPTURE(i);
+            REQUIRE_THAT(C[i], WithinAbs(C2[i], util::precision<TestType> * magnitude));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("execution plans match gemm", "[plan]", float, double) {
+    auto dims = GENERATE(std::tuple{1, 1, 1}, std::tuple{17, 33, 49}, std::tuple{63, 63, 63}, std::tuple{64, 65, 66});
+
+    const auto [M, N, K] = dims;
+    CAPTURE(M, N, K);
+
+    const auto A = util::random_vector<TestType>(M * K);
+    const auto B = util::random_vector<TestType>(K * N);
+    auto C = util::random_vector<TestType>(M * N);
+    auto C2 = C;
+
+    const TestType alpha = util::random_float<TestType>();
+    const TestType beta = util::random_float<TestType>();
+
+    // the plan replays the same kernels, so the results are identical
+    gemm::gemm_plan<TestType> plan(transposition::none, transposition::none, M, N, K, K, N, N, 1);
+    plan.execute(alpha, A.data(), B.data(), beta, C.data());
+    gemm::gemm<TestType>(transposition::none, transposition::none, M, N, K, alpha, A.data(), K, B.data(), N, beta, C2.data(), N, 1);
+
+    REQUIRE(C == C2);
+}
@@ -0,0 +1,202 @@
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <gemm/quantized.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "util.hpp"
+
+namespace
+{
+    template<typename T>
+    std::vector<T> random_integers(const int size) {
+        static std::mt19937 gen(Catch::getSeed());
+        std::uniform_int_distribution<int> dist(std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+        std::vector<T> v(size);
+        for (auto& e : v) {
+            e = static_cast<T>(dist(gen));
+        }
+        return v;
+    }
+
+    // sum_k (op(A)[i][k] - za) * (op(B)[k][j] - zb), computed naively
+    std::vector<std::int32_t> reference_sums(const bool transA, const bool transB, const int M, const int N, const int K, const std::uint8_t* A,
+      const int lda, const std::int8_t* B, const int ldb, const gemm::quantization& params) {
+        std::vector<std::int32_t> sums(M * N);
+        for (int i = 0; i < M; i++) {
+            for (int j = 0; j < N; j++) {
+                std::int32_t sum = 0;
+                for (int k = 0; k < K; k++) {
+                    const std::int32_t a = A[transA ? k * lda + i : i * lda + k] - params.zero_point_A;
+                    const std::int32_t b = B[transB ? j * ldb + k : k * ldb + j] - params.zero_point_B;
+                    sum += a * b;
+                }
+                sums[i * N + j] = sum;
+            }
+        }
+        return sums;
+    }
+
+    float scale(const gemm::quantization& params, const int i, const int j) {
+        float value = 1;
+        if (params.row_scales != nullptr) {
+            value *= params.row_scales[i];
+        }
+        if (params.col_scales != nullptr) {
+            value *= params.col_scales[j];
+        }
+        return value;
+    }
+} // namespace
+
+TEST_CASE("Quantized multiplication", "[quantized]") {
+    auto transA = GENERATE(gemm::transposition::none, gemm::transposition::transpose);
+    auto transB = GENERATE(gemm::transposition::none, gemm::transposition::transpose);
+    auto M = GENERATE(1, 13, 250);
+    auto N = GENERATE(7, 64, 301);
+    auto K = GENERATE(0, 5, 300, 700);
+    auto zero_points = GENERATE(std::pair{0, 0}, std::pair{128, 0}, std::pair{3, -7});
+
+    CAPTURE(transA, transB, M, N, K, zero_points.first, zero_points.second);
+    const bool transposed_A = transA != gemm::transposition::none;
+    const bool transposed_B = transB != gemm::transposition::none;
+    const int lda = transposed_A ? M + 2 : K + 2;
+    const int ldb = transposed_B ? K + 1 : N + 1;
+    const int ldc = N + 3;
+
+    const auto A = random_integers<std::uint8_t>((transposed_A ? K : M) * lda);
+    const auto B = random_integers<std::int8_t>((transposed_B ? N : K) * ldb);
+    std::vector<float> row_scales(M);
+    std::vector<float> col_scales(N);
+    for (auto& s : row_scales) {
+        s = std::abs(util::random_float<float>()) * 1e-3f;
+    }
+    for (auto& s : col_scales) {
+        s = std::abs(util::random_float<float>()) * 1e-2f;
+    }
+
+    gemm::quantization params;
+    params.zero_point_A = zero_points.first;
+    params.zero_point_B = zero_points.second;
+    const auto sums = reference_sums(transposed_A, transposed_B, M, N, K, A.data(), lda, B.data(), ldb, params);
+
+    SECTION("32-bit sums") {
+        std::vector<std::int32_t> C(M * ldc, 42);
+        gemm::gemm(transA, transB, M, N, K, A.data(), lda, B.data(), ldb, C.data(), ldc, params);
+        for (int i = 0; i < M; i++) {
+            for (int j = 0; j < N; j++) {
+                CAPTURE(i, j);
+                REQUIRE(C[i * ldc + j] == sums[i * N + j]);
+            }
+            // the padding of the rows is not written
+            REQUIRE(C[i * ldc + N] == 42);
+        }
+    }
+
+    SECTION("Dequantized result") {
+        params.row_scales = row_scales.data();
+        params.col_scales = col_scales.data();
+        std::vector<float> C(M * ldc);
+        gemm::gemm(transA, transB, M, N, K, A.data(), lda, B.data(), ldb, C.data(), ldc, params);
+        for (int i = 0; i < M; i++) {
+            for (int j = 0; j < N; j++) {
+                CAPTURE(i, j);
+                const float expected = static_cast<float>(sums[i * N + j]) * scale(params, i, j);
+                REQUIRE(std::abs(C[i * ldc + j] - expected) <= 1e-6f * std::abs(expected));
+            }
+        }
+    }
+
+    SECTION("Requantized result") {
+        params.row_scales = row_scales.data();
+        params.col_scales = col_scales.data();
+        params.zero_point_C = 100;
+        std::vector<std::uint8_t> C(M * ldc);
+        gemm::gemm(transA, transB, M, N, K, A.data(), lda, B.data(), ldb, C.data(), ldc, params);
+        for (int i = 0; i < M; i++) {
+            for (int j = 0; j < N; j++) {
+                CAPTURE(i, j);
+                const float value = std::nearbyint(static_cast<float>(sums[i * N + j]) * scale(params, i, j)) + params.zero_point_C;
+                const int expected = static_cast<int>(std::clamp(value, 0.0f, 255.0f));
+                // the rounding of a value close to a half integer may differ
+                REQUIRE(std::abs(C[i * ldc + j] - expected) <= 1);
+            }
+        }
+    }
+}
+
+TEST_CASE("Quantized multiplication with multiple threads", "[quantized]") {
+    const int M = 517;
+    const int N = 1030;
+    const int K = 600;
+    const auto A = random_integers<std::uint8_t>(M * K);
+    const auto B = random_integers<std::int8_t>(K * N);
+    const gemm::quantization params{.zero_point_A = 120, .zero_point_B = 1};
+    const auto sums = reference_sums(false, false, M, N, K, A.data(), K, B.data(), N, params);
+
+    for (const int nb_threads : {1, 2, 4, 7}) {
+        CAPTURE(nb_threads);
+        std::vector<std::int32_t> C(M * N);
+        gemm::gemm(gemm::transposition::none, gemm::transposition::none, M, N, K, A.data(), K, B.data(), N, C.data(), N, params, nb_threads);
+        REQUIRE(C == sums);
+    }
+}
+
+TEST_CASE("Quantized multiplication of extreme values", "[quantized]") {
+    // pairs of products of 255 and -128 (or 127) do not fit on 16 bits, so no pair may be saturated by the kernel
+    const int M = 19;
+    const int N = 45;
+    const int K = GENERATE(3, 257, 1001);
+    CAPTURE(K);
+    std::vector<std::uint8_t> A(M * K, 255);
+    std::vector<std::int8_t> B(K * N);
+    for (int k = 0; k < K; k++) {
+        for (int j = 0; j < N; j++) {
+            B[k * N + j] = (k / 2 + j) % 3 == 0 ? std::int8_t{127} : std::int8_t{-128};
+        }
+    }
+    const auto sums = reference_sums(false, false, M, N, K, A.data(), K, B.data(), N, {});
+
+    std::vector<std::int32_t> C(M * N);
+    gemm::gemm(gemm::transposition::none, gemm::transposition::none, M, N, K, A.data(), K, B.data(), N, C.data(), N);
+    REQUIRE(C == sums);
+
+    std::vector<float> C_float(M * N);
+    gemm::gemm(gemm::transposition::none, gemm::transposition::none, M, N, K, A.data(), K, B.data(), N, C_float.data(), N);
+    for (int i = 0; i < M * N; i++) {
+        REQUIRE(C_float[i] == static_cast<float>(sums[i]));
+    }
+}
+
+TEST_CASE("Quantized multiplication with a long K", "[quantized]") {
+    // a single 32-bit sum of 255 * -128 would overflow after 65793 products
+    const int M = 5;
+    const int N = 21;
+    const int K = 2 * 65536 + 37;
+    const std::vector<std::uint8_t> A(M * K, 255);
+    const std::vector<std::int8_t> B(K * N, -128);
+    const gemm::quantization params{.zero_point_A = 3, .zero_point_B = -7};
+    const double expected = double{K} * (255 - params.zero_point_A) * (-128 - params.zero_point_B);
+
+    std::vector<float> C(M * N);
+    gemm::gemm(gemm::transposition::none, gemm::transposition::none, M, N, K, A.data(), K, B.data(), N, C.data(), N, params);
+    for (int i = 0; i < M * N; i++) {
+        CAPTURE(i);
+        REQUIRE(std::abs(C[i] - expected) <= 1e-6 * std::abs(expected));
+    }
+
+    // the 32-bit sums cannot hold the result
+    std::vector<std::int32_t> C_int(M * N);
+    REQUIRE_THROWS_AS(
+      gemm::gemm(gemm::transposition::none, gemm::transposition::none, M, N, K, A.data(), K, B.data(), N, C_int.data(), N, params), std::length_error);
+}
@@ -0,0 +1,85 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <gemm/gemm.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "util.hpp"
+
+using Catch::Matchers::WithinAbs;
+
+using gemm::transposition;
+
+TEMPLATE_TEST_CASE("skinny matrices", "[rectangle][skinny]", float, double) {
+    auto transA = GENERATE(transposition::none, transposition::transpose);
+    auto transB = GENERATE(transposition::none, transposition::transpose);
+    auto dims = GENERATE(std::pair{1, 1000}, std::pair{1000, 1}, std::pair{3, 517}, std::pair{301, 4}, std::pair{2, 90}, std::pair{70, 1});
+    auto K = GENERATE(0, 1, 13, 700);
+    const auto [M, N] = dims;
+    auto nb_threads = GENERATE(1, 4);
+
+    CAPTURE(transA, transB, M, N, K, nb_threads);
+    const int lda = (transA == transposition::none ? K : M) + 3;
+    const int ldb = (transB == transposition::none ? N : K) + 5;
+    const int ldc = N + 1;
+
+    const auto A = util::random_vector<TestType>((transA == transposition::none ? M : K) * lda);
+    const auto B = util::random_vector<TestType>((transB == transposition::none ? K : N) * ldb);
+    auto C = util::random_vector<TestType>(M * ldc);
+    auto C2 = C;
+
+    const TestType alpha = util::random_float<TestType>();
+    const TestType beta = util::random_float<TestType>();
+
+    gemm::gemm<TestType>(transA, transB, M, N, K, alpha, A.data(), lda, B.data(), ldb, beta, C.data(), ldc, nb_threads);
+    util::cblas_gemm(transA, transB, M, N, K, alpha, A.data(), lda, B.data(), ldb, beta, C2.data(), ldc);
+
+    // the error is relative to the magnitude of C, as the long sums of products of both signs cancel out
+    TestType magnitude = 0;
+    for (const TestType c : C2) {
+        magnitude = std::max(magnitude, std::abs(c));
+    }
+    for (std::size_t i = 0; i < C.size(); i++) {
+        CAPTURE(i);
+        REQUIRE_THAT(C[i], WithinAbs(C2[i], util::precision<TestType> * magnitude));
+    }
+}
+
+TEMPLATE_TEST_CASE("skinny matrices with a long K", "[rectangle][skinny]", float, double) {
+    // the long dimension is too short for the threads, so K is split between them
+    auto transA = GENERATE(transposition::none, transposition::transpose);
+    auto transB = GENERATE(transposition::none, transposition::transpose);
+    auto dims = GENERATE(std::pair{4, 300}, std::pair{300, 1}, std::pair{2, 3});
+    const int K = 30011;
+    const auto [M, N] = dims;
+    auto nb_threads = GENERATE(1, 4);
+
+    CAPTURE(transA, transB, M, N, nb_threads);
+    const int lda = transA == transposition::none ? K : M;
+    const int ldb = transB == transposition::none ? N : K;
+
+    const auto A = util::random_vector<TestType>(M * K);
+    const auto B = util::random_vector<TestType>(K * N);
+    auto C = util::random_vector<TestType>(M * N);
+    auto C2 = C;
+
+    const TestType alpha = util::random_float<TestType>();
+    const TestType beta = util::random_float<TestType>();
+
+    gemm::gemm<TestType>(transA, transB, M, N, K, alpha, A.data(), lda, B.data(), ldb, beta, C.data(), N, nb_threads);
+    util::cblas_gemm(transA, transB, M, N, K, alpha, A.data(), lda, B.data(), ldb, beta, C2.data(), N);
+
+    TestType magnitude = 0;
+    for (const TestType c : C2) {
+        magnitude = std::max(magnitude, std::abs(c));
+    }
+    for (std::size_t i = 0; i < C.size(); i++) {
+        CAPTURE(i);
+        REQUIRE_THAT(C[i], WithinAbs(C2[i], util::precision<TestType> * magnitude));
+    }
+}
@@ -4,6 +4,10 @@
 #include <catch2/generators/catch_generators_range.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
+#include <limits>
+#include <utility>
+#include <vector>
+
 #include <gemm/gemm.hpp>
 
 #include "util.hpp"
@@ -101,3 +105,42 @@ TEMPLATE_TEST_CASE("column", "[large][special]", float, double) {
         REQUIRE_THAT(C[i], WithinRel(C2[i], util::precision<TestType>));
     }
 }
+
+TEMPLATE_TEST_CASE("empty product with beta = 0", "[large][special]", float, double) {
+    constexpr int M = BM<TestType> + 1;
+    constexpr int N = BN<TestType> + 1;
+    constexpr int K = 0;
+
+    const std::vector<TestType> A(1);
+    const std::vector<TestType> B(1);
+    std::vector<TestType> C(M * N, std::numeric_limits<TestType>::quiet_NaN());
+
+    const TestType alpha = util::random_float<TestType>();
+
+    // C is not read if beta is 0, so its NaN are not propagated
+    util::gemm(M, N, K, alpha, A.data(), 1, B.data(), N, TestType{0}, C.data(), N);
+
+    for (std::size_t i = 0; i < C.size(); i++) {
+        CAPTURE(i);
+        REQUIRE(C[i] == 0);
+    }
+}
+
+TEMPLATE_TEST_CASE("small empty product with beta = 0", "[small][special]", float, double) {
+    const auto [M, N] = GENERATE(std::pair{1, 1}, std::pair{20, 30});
+    constexpr int K = 0;
+    CAPTURE(M, N);
+
+    const std::vector<TestType> A(1);
+    const std::vector<TestType> B(1);
+    std::vector<TestType> C(M * N, std::numeric_limits<TestType>::quiet_NaN());
+
+    const TestType alpha = util::random_float<TestType>();
+
+    util::gemm(M, N, K, alpha, A.data(), 1, B.data(), N, TestType{0}, C.data(), N);
+
+    for (std::size_t i = 0; i < C.size(); i++) {
+        CAPTURE(i);
+        REQUIRE(C[i] == 0);
+    }
+}
@@ -0,0 +1,57 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <gemm/strassen.hpp>
+
+#include <cmath>
+
+#include "util.hpp"
+
+using gemm::transposition;
+
+TEMPLATE_TEST_CASE("Strassen-Winograd", "[strassen]", float, double) {
+    auto transA = GENERATE(transposition::none, transposition::transpose);
+    auto transB = GENERATE(transposition::none, transposition::transpose);
+    auto M = GENERATE(128, 201);
+    auto N = GENERATE(130, 257);
+    auto K = GENERATE(150, 263);
+    auto levels = GENERATE(1, 3);
+    auto beta_zero = GENERATE(false, true);
+
+    CAPTURE(transA, transB, M, N, K, levels, beta_zero);
+    // small crossover, so that odd dimensions appear at several levels
+    const gemm::strassen_options options{.crossover = 32, .max_levels = levels};
+    const int lda = (transA == transposition::none ? K : M) + 3;
+    const int ldb = (transB == transposition::none ? N : K) + 5;
+    const int ldc = N + 1;
+
+    const auto A = util::random_vector<TestType>((transA == transposition::none ? M : K) * lda);
+    const auto B = util::random_vector<TestType>((transB == transposition::none ? K : N) * ldb);
+    auto C = util::random_vector<TestType>(M * ldc);
+    auto C2 = C;
+
+    const TestType alpha = util::random_float<TestType>();
+    const TestType beta = beta_zero ? 0 : util::random_float<TestType>();
+
+    gemm::gemm_strassen<TestType>(transA, transB, M, N, K, alpha, A.data(), lda, B.data(), ldb, beta, C.data(), ldc, 1, options);
+    util::cblas_gemm(transA, transB, M, N, K, alpha, A.data(), lda, B.data(), ldb, beta, C2.data(), ldc);
+
+    // the error bound of the algorithm is normwise
+    const TestType magnitude = util::max_magnitude(C2);
+    for (std::size_t i = 0; i < C.size(); i++) {
+        CAPTURE(i);
+        REQUIRE(std::abs(C[i] - C2[i]) <= util::precision<TestType> * magnitude);
+    }
+}
+
+TEST_CASE("Strassen-Winograd workspace", "[strassen]") {
+    const gemm::strassen_options options{.crossover = 64, .max_levels = 2};
+
+    // below the crossover, the regular multiplication is used
+    REQUIRE(gemm::strassen_workspace_size<double>(63, 500, 500, 1, options) == gemm::workspace_size<double>(63, 500, 500, 1));
+
+    // the temporaries of each level are part of the workspace
+    const std::size_t level_temporaries = 3 * 100 * 100;
+    REQUIRE(gemm::strassen_workspace_size<double>(200, 200, 200, 1, options) >= level_temporaries + 3 * 50 * 50);
+}
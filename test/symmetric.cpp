@@ -0,0 +1,105 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <gemm/symmetric.hpp>
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "util.hpp"
+
+using Catch::Matchers::WithinAbs;
+
+using gemm::side;
+using gemm::transposition;
+using gemm::triangle;
+
+namespace
+{
+    CBLAS_UPLO cblas_triangle(const triangle uplo) {
+        return uplo == triangle::lower ? CblasLower : CblasUpper;
+    }
+} // namespace
+
+TEMPLATE_TEST_CASE("symmetric rank-k update", "[symmetric][syrk]", float, double) {
+    auto uplo = GENERATE(triangle::lower, triangle::upper);
+    auto trans = GENERATE(transposition::none, transposition::transpose);
+    auto N = GENERATE(1, 7, 63, 200, 517);
+    auto K = GENERATE(0, 1, 70, 301);
+    auto nb_threads = GENERATE(1, 4);
+    auto beta_zero = GENERATE(false, true);
+
+    CAPTURE(uplo, trans, N, K, nb_threads, beta_zero);
+    const int lda = (trans == transposition::none ? K : N) + 3;
+    const int ldc = N + 1;
+
+    const auto A = util::random_vector<TestType>((trans == transposition::none ? N : K) * lda);
+    auto C = util::random_vector<TestType>(N * ldc);
+    const auto old_C = C;
+    auto C2 = C;
+
+    const TestType alpha = util::random_float<TestType>();
+    const TestType beta = beta_zero ? 0 : util::random_float<TestType>();
+
+    gemm::syrk<TestType>(uplo, trans, N, K, alpha, A.data(), lda, beta, C.data(), ldc, nb_threads);
+    const auto cblas_trans = util::cblas_transposition(trans);
+    if constexpr (std::is_same_v<TestType, float>) {
+        cblas_ssyrk(CblasRowMajor, cblas_triangle(uplo), cblas_trans, N, K, alpha, A.data(), lda, beta, C2.data(), ldc);
+    } else {
+        cblas_dsyrk(CblasRowMajor, cblas_triangle(uplo), cblas_trans, N, K, alpha, A.data(), lda, beta, C2.data(), ldc);
+    }
+
+    // the other triangle is left untouched
+    const TestType magnitude = util::max_magnitude(C2);
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
+            CAPTURE(i, j);
+            const bool written = uplo == triangle::lower ? j <= i : j >= i;
+            if (written) {
+                REQUIRE_THAT(C[i * ldc + j], WithinAbs(C2[i * ldc + j], util::precision<TestType> * magnitude));
+            } else {
+                REQUIRE(C[i * ldc + j] == old_C[i * ldc + j]);
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("symmetric multiplication", "[symmetric][symm]", float, double) {
+    auto sideA = GENERATE(side::left, side::right);
+    auto uplo = GENERATE(triangle::lower, triangle::upper);
+    auto dims = GENERATE(std::pair{1, 1}, std::pair{5, 90}, std::pair{301, 77}, std::pair{260, 517});
+    auto nb_threads = GENERATE(1, 4);
+
+    const auto [M, N] = dims;
+    CAPTURE(sideA, uplo, M, N, nb_threads);
+    const int dim_A = sideA == side::left ? M : N;
+    const int lda = dim_A + 3;
+    const int ldb = N + 5;
+    const int ldc = N + 1;
+
+    // A is not symmetric: the triangle which is not read differs from the mirror of the other one
+    const auto A = util::random_vector<TestType>(dim_A * lda);
+    const auto B = util::random_vector<TestType>(M * ldb);
+    auto C = util::random_vector<TestType>(M * ldc);
+    auto C2 = C;
+
+    const TestType alpha = util::random_float<TestType>();
+    const TestType beta = util::random_float<TestType>();
+
+    gemm::symm<TestType>(sideA, uplo, M, N, alpha, A.data(), lda, B.data(), ldb, beta, C.data(), ldc, nb_threads);
+    const auto cblas_side = sideA == side::left ? CblasLeft : CblasRight;
+    if constexpr (std::is_same_v<TestType, float>) {
+        cblas_ssymm(CblasRowMajor, cblas_side, cblas_triangle(uplo), M, N, alpha, A.data(), lda, B.data(), ldb, beta, C2.data(), ldc);
+    } else {
+        cblas_dsymm(CblasRowMajor, cblas_side, cblas_triangle(uplo), M, N, alpha, A.data(), lda, B.data(), ldb, beta, C2.data(), ldc);
+    }
+
+    const TestType magnitude = util::max_magnitude(C2);
+    for (std::size_t i = 0; i < C.size(); i++) {
+        CAPTURE(i);
+        REQUIRE_THAT(C[i], WithinAbs(C2[i], util::precision<TestType> * magnitude));
+    }
+}
@@ -0,0 +1,42 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <gemm/gemm.hpp>
+
+#include "util.hpp"
+
+using Catch::Matchers::WithinRel;
+
+using gemm::transposition;
+
+TEMPLATE_TEST_CASE("transposition", "[rectangle][transposition]", float, double) {
+    auto transA = GENERATE(transposition::none, transposition::transpose, transposition::conjugate_transpose);
+    auto transB = GENERATE(transposition::none, transposition::transpose);
+    auto M = GENERATE(5, 63, 329);
+    auto N = GENERATE(8, 17, 257);
+    auto K = GENERATE(1, 30, 100);
+
+    CAPTURE(transA, transB, M, N, K);
+    // leading dimensions larger than needed, to check that the strides are respected
+    const int lda = (transA == transposition::none ? K : M) + 3;
+    const int ldb = (transB == transposition::none ? N : K) + 5;
+    const int ldc = N + 1;
+
+    const auto A = util::random_vector<TestType>((transA == transposition::none ? M : K) * lda);
+    const auto B = util::random_vector<TestType>((transB == transposition::none ? K : N) * ldb);
+    auto C = util::random_vector<TestType>(M * ldc);
+    auto C2 = C;
+
+    const TestType alpha = util::random_float<TestType>();
+    const TestType beta = util::random_float<TestType>();
+
+    gemm::gemm<TestType>(transA, transB, M, N, K, alpha, A.data(), lda, B.data(), ldb, beta, C.data(), ldc);
+    util::cblas_gemm(transA, transB, M, N, K, alpha, A.data(), lda, B.data(), ldb, beta, C2.data(), ldc);
+
+    for (std::size_t i = 0; i < C.size(); i++) {
+        CAPTURE(i);
+        REQUIRE_THAT(C[i], WithinRel(C2[i], util::precision<TestType>));
+    }
+}
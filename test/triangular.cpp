@@ -0,0 +1,84 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <gemm/triangular.hpp>
+
+#include <cmath>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "util.hpp"
+
+using Catch::Matchers::WithinAbs;
+
+using gemm::diagonal;
+using gemm::side;
+using gemm::transposition;
+using gemm::triangle;
+
+namespace
+{
+    // A triangular matrix whose off-diagonal elements are small enough for the solves to be well conditioned
+    template<typename T>
+    std::vector<T> triangular_matrix(const int dim, const int ld) {
+        auto A = util::random_vector<T>(dim * ld);
+        for (int i = 0; i < dim; i++) {
+            for (int j = 0; j < dim; j++) {
+                T& a = A[i * ld + j];
+                a = i == j ? T{2} + std::abs(a) : a / (T{10} * dim);
+            }
+        }
+        return A;
+    }
+
+    template<typename T>
+    void cblas_triangular(const bool solve, const side sideA, const triangle uplo, const transposition transA, const diagonal diag, const int M,
+      const int N, const T alpha, const T* A, const int lda, T* B, const int ldb) {
+        const auto s = sideA == side::left ? CblasLeft : CblasRight;
+        const auto u = uplo == triangle::lower ? CblasLower : CblasUpper;
+        const auto t = util::cblas_transposition(transA);
+        const auto d = diag == diagonal::unit ? CblasUnit : CblasNonUnit;
+        if constexpr (std::is_same_v<T, float>) {
+            (solve ? cblas_strsm : cblas_strmm)(CblasRowMajor, s, u, t, d, M, N, alpha, A, lda, B, ldb);
+        } else {
+            (solve ? cblas_dtrsm : cblas_dtrmm)(CblasRowMajor, s, u, t, d, M, N, alpha, A, lda, B, ldb);
+        }
+    }
+} // namespace
+
+TEMPLATE_TEST_CASE("triangular matrices", "[triangular]", float, double) {
+    auto solve = GENERATE(false, true);
+    auto sideA = GENERATE(side::left, side::right);
+    auto uplo = GENERATE(triangle::lower, triangle::upper);
+    auto transA = GENERATE(transposition::none, transposition::transpose);
+    auto diag = GENERATE(diagonal::non_unit, diagonal::unit);
+    auto dims = GENERATE(std::pair{1, 1}, std::pair{7, 300}, std::pair{300, 7}, std::pair{64, 65}, std::pair{200, 150});
+    auto nb_threads = GENERATE(1, 4);
+
+    const auto [M, N] = dims;
+    CAPTURE(solve, sideA, uplo, transA, diag, M, N, nb_threads);
+    const int dim_A = sideA == side::left ? M : N;
+    const int lda = dim_A + 3;
+    const int ldb = N + 5;
+
+    const auto A = triangular_matrix<TestType>(dim_A, lda);
+    auto B = util::random_vector<TestType>(M * ldb);
+    auto B2 = B;
+    const TestType alpha = util::random_float<TestType>();
+
+    if (solve) {
+        gemm::trsm<TestType>(sideA, uplo, transA, diag, M, N, alpha, A.data(), lda, B.data(), ldb, nb_threads);
+    } else {
+        gemm::trmm<TestType>(sideA, uplo, transA, diag, M, N, alpha, A.data(), lda, B.data(), ldb, nb_threads);
+    }
+    cblas_triangular(solve, sideA, uplo, transA, diag, M, N, alpha, A.data(), lda, B2.data(), ldb);
+
+    const TestType magnitude = util::max_magnitude(B2);
+    for (std::size_t i = 0; i < B.size(); i++) {
+        CAPTURE(i);
+        REQUIRE_THAT(B[i], WithinAbs(B2[i], util::precision<TestType> * magnitude));
+    }
+}
@@ -0,0 +1,167 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <gemm/gemm.hpp>
+#include <gemm/tuning.hpp>
+
+#include <filesystem>
+
+#include "util.hpp"
+
+using Catch::Matchers::WithinRel;
+
+// Restores the block sizes of the process at the end of a test
+template<typename T>
+struct blocking_guard {
+    gemm::blocking saved = gemm::get_blocking<T>();
+
+    ~blocking_guard() {
+        gemm::set_blocking<T>(saved);
+    }
+};
+
+TEMPLATE_TEST_CASE("custom block sizes", "[rectangle][tuning]", float, double) {
+    constexpr int tile_width = gemm::detail::TILE_WIDTH<TestType>;
+    const blocking_guard<TestType> guard;
+
+    auto tile_height = GENERATE(from_range(gemm::detail::tile_heights));
+    auto BN = tile_width * GENERATE(1, 8);
+    auto BK = GENERATE(16, 128);
+    const int BM = 12 * tile_height;
+
+    CAPTURE(BM, BN, BK, tile_height);
+    REQUIRE(gemm::set_blocking<TestType>({BM, BN, BK, tile_height}));
+
+    constexpr int M = 329;
+    constexpr int N = 257;
+    constexpr int K = 150;
+    const auto A = util::random_vector<TestType>(M * K);
+    const auto B = util::random_vector<TestType>(K * N);
+    auto C = util::random_vector<TestType>(M * N);
+    auto C2 = C;
+
+    const TestType alpha = util::random_float<TestType>();
+    const TestType beta = util::random_float<TestType>();
+
+    util::gemm(M, N, K, alpha, A.data(), K, B.data(), N, beta, C.data(), N);
+    util::cblas_gemm(M, N, K, alpha, A.data(), K, B.data(), N, beta, C2.data(), N);
+
+    for (std::size_t i = 0; i < C.size(); i++) {
+        CAPTURE(i);
+        REQUIRE_THAT(C[i], WithinRel(C2[i], util::precision<TestType>));
+    }
+}
+
+TEMPLATE_TEST_CASE("packed matrix keeps its block sizes", "[rectangle][tuning]", float, double) {
+    constexpr int tile_width = gemm::detail::TILE_WIDTH<TestType>;
+    const blocking_guard<TestType> guard;
+
+    constexpr int M = 100;
+    constexpr int N = 200;
+    constexpr int K = 90;
+    const auto A = util::random_vector<TestType>(M * K);
+    const auto B = util::random_vector<TestType>(K * N);
+    auto C = util::random_vector<TestType>(M * N);
+    auto C2 = C;
+
+    REQUIRE(gemm::set_blocking<TestType>({40, 2 * tile_width, 24, 4}));
+    const gemm::packed_matrix<TestType> packed_B(gemm::transposition::none, K, N, B.data(), N);
+    REQUIRE(gemm::set_blocking<TestType>({60, 4 * tile_width, 50, 6}));
+
+    gemm::gemm<TestType>(gemm::transposition::none, M, 1, A.data(), K, packed_B, 1, C.data(), N);
+    util::cblas_gemm<TestType>(M, N, K, 1, A.data(), K, B.data(), N, 1, C2.data(), N);
+
+    for (std::size_t i = 0; i < C.size(); i++) {
+        CAPTURE(i);
+        REQUIRE_THAT(C[i], WithinRel(C2[i], util::precision<TestType>));
+    }
+}
+
+TEST_CASE("invalid block sizes", "[tuning]") {
+    const auto sizes = gemm::get_blocking<float>();
+
+    // the tile height is not compiled, BM is not a multiple of the tile height, BN is not a multiple of the tile width
+    REQUIRE_FALSE(gemm::set_blocking<float>({64, 64, 64, 7}));
+    REQUIRE_FALSE(gemm::set_blocking<float>({65, 64, 64, 4}));
+    REQUIRE_FALSE(gemm::set_blocking<float>({64, gemm::detail::TILE_WIDTH<float> + 1, 64, 4}));
+    REQUIRE_FALSE(gemm::set_blocking<float>({64, 64, 0, 4}));
+
+    // the tile does not fit in the registers of the target
+    if constexpr (!gemm::detail::fits_registers(12)) {
+        REQUIRE_FALSE(gemm::set_blocking<float>({96, 64, 64, 12}));
+    }
+
+    REQUIRE(gemm::get_blocking<float>() == sizes);
+}
+
+TEST_CASE("tuning profile", "[tuning]") {
+    const blocking_guard<float> float_guard;
+    const blocking_guard<double> double_guard;
+
+    const gemm::blocking float_sizes = {96, 4 * gemm::detail::TILE_WIDTH<float>, 128, gemm::detail::tile_heights.back()};
+    const gemm::blocking double_sizes = {64, 2 * gemm::detail::TILE_WIDTH<double>, 96, gemm::detail::tile_heights.front()};
+    const auto path = (std::filesystem::temp_directory_path() / "gemm_tuning_profile_test.txt").string();
+
+    REQUIRE(gemm::save_tuning_profile(path, float_sizes, double_sizes));
+    REQUIRE(gemm::load_tuning_profile(path));
+    std::filesystem::remove(path);
+
+    REQUIRE(gemm::get_blocking<float>() == float_sizes);
+    REQUIRE(gemm::get_blocking<double>() == double_sizes);
+
+    REQUIRE_FALSE(gemm::load_tuning_profile(path));
+    REQUIRE(gemm::get_blocking<float>() == float_sizes);
+}
+
+TEMPLATE_TEST_CASE("block sizes derived from the caches", "[tuning]", float, double) {
+    using gemm::detail::cache_sizes;
+
+    const auto L1 = GENERATE(std::size_t{32} << 10, std::size_t{48} << 10);
+    const auto L2 = GENERATE(std::size_t{512} << 10, std::size_t{1280} << 10, std::size_t{2} << 20);
+    const auto L3 = GENERATE(std::size_t{0}, std::size_t{4} << 20, std::size_t{32} << 20);
+
+    CAPTURE(L1, L2, L3);
+    const auto sizes = gemm::detail::model_blocking<TestType>(cache_sizes{L1, L2, L3});
+    CAPTURE(sizes.BM, sizes.BN, sizes.BK, sizes.tile_height);
+
+    REQUIRE(gemm::detail::is_valid<TestType>(sizes));
+    // the rows of A and the columns of B read by a tile fit in L1, the block of B in L2
+    REQUIRE((sizes.tile_height + gemm::detail::TILE_WIDTH<TestType>) * sizes.BK * sizeof(TestType) <= L1);
+    REQUIRE(static_cast<std::size_t>(sizes.BK) * sizes.BN * sizeof(TestType) <= L2);
+
+    REQUIRE(gemm::detail::model_blocking<TestType>(cache_sizes{}) == gemm::detail::default_blocking<TestType>);
+}
+
+TEMPLATE_TEST_CASE("panel width derived from the shared cache", "[tuning]", float, double) {
+    constexpr int tile_width = gemm::detail::TILE_WIDTH<TestType>;
+    const gemm::blocking sizes = {120, 4 * tile_width, 256, 6};
+
+    const auto shared_cache = GENERATE(std::size_t{1} << 10, std::size_t{8} << 20, std::size_t{256} << 20);
+    const auto N = GENERATE(1, 1000, 100000);
+
+    CAPTURE(shared_cache, N);
+    const int NC = gemm::detail::model_panel_width<TestType>(sizes, N, shared_cache);
+
+    // whole blocks, at least one, and no more than needed to cover N
+    REQUIRE(NC % sizes.BN == 0);
+    REQUIRE(NC >= sizes.BN);
+    REQUIRE(NC < N + sizes.BN);
+    // the panel fits in half of the cache, unless it is a single block
+    if (NC > sizes.BN) {
+        REQUIRE(static_cast<std::size_t>(NC) * sizes.BK * sizeof(TestType) <= shared_cache / 2);
+    }
+}
+
+TEST_CASE("cache description parsing", "[tuning]") {
+    REQUIRE(gemm::detail::parse_cache_size("48K") == 48 << 10);
+    REQUIRE(gemm::detail::parse_cache_size("32M") == 32 << 20);
+    REQUIRE(gemm::detail::parse_cache_size("1024") == 1024);
+    REQUIRE(gemm::detail::parse_cache_size("") == 0);
+
+    REQUIRE(gemm::detail::count_cpus("0") == 1);
+    REQUIRE(gemm::detail::count_cpus("0,64") == 2);
+    REQUIRE(gemm::detail::count_cpus("0-7,16-23") == 16);
+}
@@ -4,6 +4,8 @@
 #include <catch2/catch_get_random_seed.hpp>
 #include <cblas.h>
 
+#include <algorithm>
+#include <cmath>
 #include <random>
 #include <vector>
 
@@ -55,6 +57,41 @@ namespace util
             cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
         }
     }
+
+    // Largest absolute value of a matrix, the scale of the normwise comparisons with the cblas results
+    template<typename T>
+    T max_magnitude(const std::vector<T>& C) {
+        T magnitude = 0;
+        for (const T c : C) {
+            magnitude = std::max(magnitude, std::abs(c));
+        }
+        return magnitude;
+    }
+
+    // Converts a transposition setting to its cblas equivalent
+    inline CBLAS_TRANSPOSE cblas_transposition(gemm::transposition trans) {
+        switch (trans) {
+        case gemm::transposition::transpose:
+            return CblasTrans;
+        case gemm::transposition::conjugate_transpose:
+            return CblasConjTrans;
+        default:
+            return CblasNoTrans;
+        }
+    }
+
+    // Wrapper for the openblas [s|d]gemm function, with transpositions
+    template<typename T>
+    void cblas_gemm(gemm::transposition transA, gemm::transposition transB, const int M, const int N, const int K, const T alpha, const T* A, const int lda,
+      const T* B, const int ldb, const T beta, T* C, const int ldc) {
+        const auto ta = cblas_transposition(transA);
+        const auto tb = cblas_transposition(transB);
+        if constexpr (std::is_same_v<T, float>) {
+            cblas_sgemm(CblasRowMajor, ta, tb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+        } else {
+            cblas_dgemm(CblasRowMajor, ta, tb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+        }
+    }
 } // namespace util
 
 #endif
@@ -0,0 +1,64 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <gemm/gemm.hpp>
+
+#include "util.hpp"
+
+using Catch::Matchers::WithinRel;
+
+TEMPLATE_TEST_CASE("caller supplied workspace", "[rectangle][workspace]", float, double) {
+    auto nb_threads = GENERATE(1, 4);
+    auto M = GENERATE(10, 329);
+    auto N = GENERATE(8, 257);
+    auto K = GENERATE(10, 100);
+
+    CAPTURE(nb_threads, M, N, K);
+    const auto A = util::random_vector<TestType>(M * K);
+    const auto B = util::random_vector<TestType>(K * N);
+    auto C = util::random_vector<TestType>(M * N);
+    auto C2 = C;
+
+    const TestType alpha = util::random_float<TestType>();
+    const TestType beta = util::random_float<TestType>();
+
+    gemm::workspace<TestType> ws(gemm::workspace_size<TestType>(M, N, K, nb_threads));
+    const auto* buffer = ws.data();
+
+    gemm::gemm<TestType>(gemm::transposition::none, gemm::transposition::none, M, N, K, alpha, A.data(), K, B.data(), N, beta, C.data(), N, nb_threads, ws);
+    util::cblas_gemm(M, N, K, alpha, A.data(), K, B.data(), N, beta, C2.data(), N);
+
+    // a workspace of the queried size is not reallocated
+    REQUIRE(ws.data() == buffer);
+
+    for (std::size_t i = 0; i < C.size(); i++) {
+        CAPTURE(i);
+        REQUIRE_THAT(C[i], WithinRel(C2[i], util::precision<TestType>));
+    }
+}
+
+TEMPLATE_TEST_CASE("workspace growth", "[workspace]", float, double) {
+    constexpr int M = 300;
+    constexpr int N = 100;
+    constexpr int K = 100;
+
+    const auto A = util::random_vector<TestType>(M * K);
+    const auto B = util::random_vector<TestType>(K * N);
+    auto C = util::random_vector<TestType>(M * N);
+    auto C2 = C;
+
+    gemm::workspace<TestType> ws;
+    REQUIRE(ws.size() == 0);
+
+    gemm::gemm<TestType>(gemm::transposition::none, gemm::transposition::none, M, N, K, 1, A.data(), K, B.data(), N, 1, C.data(), N, 1, ws);
+    util::cblas_gemm<TestType>(M, N, K, 1, A.data(), K, B.data(), N, 1, C2.data(), N);
+
+    REQUIRE(ws.size() >= gemm::workspace_size<TestType>(M, N, K, 1));
+
+    for (std::size_t i = 0; i < C.size(); i++) {
+        CAPTURE(i);
+        REQUIRE_THAT(C[i], WithinRel(C2[i], util::precision<TestType>));
+    }
+}
@@ -12,6 +12,12 @@ package_end()
 add_requires("eve", "catch2 3.3.2", "nanobench 4.3.11", "fmt 9.1.0")
 add_requires("openblas", {system = true})
 
+option("dispatch")
+	set_default(false)
+	set_showmenu(true)
+	set_description("Build the library choosing the instruction set at runtime")
+option_end()
+
 target("gemm")
 	set_kind("headeronly")
 	add_headerfiles("include/gemm/**/*.hpp")
@@ -19,20 +25,60 @@ target("gemm")
 	add_packages("eve", {public = true})
 	set_warnings("allextra")
 
+if has_config("dispatch") then
+	local isa_flags = {
+		sse4_2 = {"-msse4.2"},
+		avx2 = {"-mavx2", "-mfma"},
+		avx512 = {"-mavx512f", "-mavx512bw", "-mavx512dq", "-mavx512vl", "-mfma"}
+	}
+
+	for isa, flags in pairs(isa_flags) do
+		target("gemm_" .. isa)
+			set_kind("shared")
+			add_files("dispatch/implementation.cpp")
+			add_deps("gemm")
+			add_cxxflags(flags)
+			add_defines("GEMM_DISPATCH_ISA=" .. isa)
+			set_symbols("hidden")
+			add_ldflags("-Wl,--version-script=dispatch/implementation.map")
+			set_warnings("allextra")
+	end
+
+	target("gemm_dispatch")
+		set_kind("shared")
+		add_files("dispatch/dispatch.cpp")
+		add_includedirs("include", {public = true})
+		add_deps("gemm_sse4_2", "gemm_avx2", "gemm_avx512")
+		set_symbols("hidden")
+		set_warnings("allextra")
+end
+
 target("test")
 	set_kind("binary")
-	add_files("test/*.cpp")
+	add_files("test/*.cpp|dispatch.cpp")
 	add_deps("gemm")
 	add_packages("catch2", "openblas")
+	if has_config("dispatch") then
+		add_files("test/dispatch.cpp")
+		add_deps("gemm_dispatch")
+	end
 	add_cxxflags("-march=native")
 	add_defines("CATCH_FAST_COMPILE")
 	set_warnings("allextra")
 
 target("benchmark")
 	set_kind("binary")
-	add_files("benchmark/*.cpp")
+	add_files("benchmark/*.cpp|autotune.cpp")
 	add_deps("gemm")
 	add_packages("nanobench", "catch2", "openblas", "fmt")
 	add_cxxflags("-march=native")
 	add_defines("CATCH_FAST_COMPILE")
 	set_warnings("allextra")
+
+target("autotune")
+	set_kind("binary")
+	add_files("benchmark/autotune.cpp")
+	add_deps("gemm")
+	add_packages("fmt")
+	add_cxxflags("-march=native")
+	set_warnings("allextra")